@@ -267,8 +267,8 @@ void propListAppender(QQmlListProperty<QObject> *propList, QObject *item)
     Shiboken::GilState state;
 
     Shiboken::AutoDecRef args(PyTuple_New(2));
-    PyTuple_SET_ITEM(args, 0, Shiboken::Conversions::pointerToPython((SbkObjectType *)SbkPySide2_QtCoreTypes[SBK_QOBJECT_IDX], propList->object));
-    PyTuple_SET_ITEM(args, 1, Shiboken::Conversions::pointerToPython((SbkObjectType *)SbkPySide2_QtCoreTypes[SBK_QOBJECT_IDX], item));
+    PyTuple_SET_ITEM(args, 0, Shiboken::Conversions::pointerToPython(reinterpret_cast<SbkObjectType *>(Shiboken::SbkType<QObject>()), propList->object));
+    PyTuple_SET_ITEM(args, 1, Shiboken::Conversions::pointerToPython(reinterpret_cast<SbkObjectType *>(Shiboken::SbkType<QObject>()), item));
 
     auto data = reinterpret_cast<QmlListProperty *>(propList->data);
     Shiboken::AutoDecRef retVal(PyObject_CallObject(data->append, args));
@@ -283,7 +283,7 @@ int propListCount(QQmlListProperty<QObject> *propList)
     Shiboken::GilState state;
 
     Shiboken::AutoDecRef args(PyTuple_New(1));
-    PyTuple_SET_ITEM(args, 0, Shiboken::Conversions::pointerToPython((SbkObjectType *)SbkPySide2_QtCoreTypes[SBK_QOBJECT_IDX], propList->object));
+    PyTuple_SET_ITEM(args, 0, Shiboken::Conversions::pointerToPython(reinterpret_cast<SbkObjectType *>(Shiboken::SbkType<QObject>()), propList->object));
 
     auto data = reinterpret_cast<QmlListProperty *>(propList->data);
     Shiboken::AutoDecRef retVal(PyObject_CallObject(data->count, args));
@@ -304,7 +304,7 @@ QObject *propListAt(QQmlListProperty<QObject> *propList, int index)
     Shiboken::GilState state;
 
     Shiboken::AutoDecRef args(PyTuple_New(2));
-    PyTuple_SET_ITEM(args, 0, Shiboken::Conversions::pointerToPython((SbkObjectType *)SbkPySide2_QtCoreTypes[SBK_QOBJECT_IDX], propList->object));
+    PyTuple_SET_ITEM(args, 0, Shiboken::Conversions::pointerToPython(reinterpret_cast<SbkObjectType *>(Shiboken::SbkType<QObject>()), propList->object));
     PyTuple_SET_ITEM(args, 1, Shiboken::Conversions::copyToPython(Shiboken::Conversions::PrimitiveTypeConverter<int>(), &index));
 
     auto data = reinterpret_cast<QmlListProperty *>(propList->data);
@@ -314,7 +314,7 @@ QObject *propListAt(QQmlListProperty<QObject> *propList, int index)
     if (PyErr_Occurred())
         PyErr_Print();
     else if (PyType_IsSubtype(Py_TYPE(retVal), data->type))
-        Shiboken::Conversions::pythonToCppPointer((SbkObjectType *)SbkPySide2_QtCoreTypes[SBK_QOBJECT_IDX], retVal, &result);
+        Shiboken::Conversions::pythonToCppPointer(reinterpret_cast<SbkObjectType *>(Shiboken::SbkType<QObject>()), retVal, &result);
     return result;
 }
 
@@ -324,7 +324,7 @@ void propListClear(QQmlListProperty<QObject> * propList)
     Shiboken::GilState state;
 
     Shiboken::AutoDecRef args(PyTuple_New(1));
-    PyTuple_SET_ITEM(args, 0, Shiboken::Conversions::pointerToPython((SbkObjectType *)SbkPySide2_QtCoreTypes[SBK_QOBJECT_IDX], propList->object));
+    PyTuple_SET_ITEM(args, 0, Shiboken::Conversions::pointerToPython(reinterpret_cast<SbkObjectType *>(Shiboken::SbkType<QObject>()), propList->object));
 
     auto data = reinterpret_cast<QmlListProperty *>(propList->data);
     Shiboken::AutoDecRef retVal(PyObject_CallObject(data->clear, args));
@@ -341,7 +341,7 @@ static void propListMetaCall(PySideProperty *pp, PyObject *self, QMetaObject::Ca
 
     auto data = reinterpret_cast<QmlListProperty *>(PySide::Property::userData(pp));
     QObject *qobj;
-    Shiboken::Conversions::pythonToCppPointer((SbkObjectType *)SbkPySide2_QtCoreTypes[SBK_QOBJECT_IDX], self, &qobj);
+    Shiboken::Conversions::pythonToCppPointer(reinterpret_cast<SbkObjectType *>(Shiboken::SbkType<QObject>()), self, &qobj);
     QQmlListProperty<QObject> declProp(qobj, data, &propListAppender, &propListCount, &propListAt, &propListClear);
 
     // Copy the data to the memory location requested by the meta call
@@ -137,44 +137,142 @@ else {
 // @snippet qsettings-value
 
 // @snippet qvariant-conversion
-static const char *QVariant_resolveMetaType(PyTypeObject *type, int *typeId)
+// Resolving the metatype of a wrapper type involves string lookups and
+// walking the base classes. The result is cached per wrapper type, together
+// with the converter. Python types derived from wrapper types are not cached
+// since they may be destroyed and their address reused; they are resolved
+// through their wrapper base classes.
+struct QVariantTypeInfo
 {
-    if (PyObject_TypeCheck(type, SbkObjectType_TypeF())) {
-        auto sbkType = reinterpret_cast<SbkObjectType *>(type);
-        const char *typeName = Shiboken::ObjectType::getOriginalName(sbkType);
-        if (!typeName)
-            return nullptr;
-        const bool valueType = '*' != typeName[qstrlen(typeName) - 1];
-        // Do not convert user type of value
-        if (valueType && Shiboken::ObjectType::isUserType(type))
-            return nullptr;
-        int obTypeId = QMetaType::type(typeName);
-        if (obTypeId) {
-            *typeId = obTypeId;
-            return typeName;
-        }
-        // Do not resolve types to value type
-        if (valueType)
-            return nullptr;
-        // Find in base types. First check tp_bases, and only after check tp_base, because
-        // tp_base does not always point to the first base class, but rather to the first
-        // that has added any python fields or slots to its object layout.
-        // See https://mail.python.org/pipermail/python-list/2009-January/520733.html
-        if (type->tp_bases) {
-            for (int i = 0, size = PyTuple_GET_SIZE(type->tp_bases); i < size; ++i) {
-                const char *derivedName = QVariant_resolveMetaType(reinterpret_cast<PyTypeObject *>(PyTuple_GET_ITEM(
-                                          type->tp_bases, i)), typeId);
-                if (derivedName)
-                    return derivedName;
+    const char *typeName;
+    int typeId;
+    Shiboken::Conversions::SpecificConverter converter;
+};
+static std::deque<QVariantTypeInfo> QVariant_typeInfoStorage;
+static std::unordered_map<PyTypeObject *, const QVariantTypeInfo *> QVariant_typeInfos;
+
+static const QVariantTypeInfo *QVariant_typeInfo(PyTypeObject *type);
+
+static const QVariantTypeInfo *QVariant_baseTypeInfo(PyTypeObject *type)
+{
+    // Find in base types. First check tp_bases, and only after check tp_base, because
+    // tp_base does not always point to the first base class, but rather to the first
+    // that has added any python fields or slots to its object layout.
+    // See https://mail.python.org/pipermail/python-list/2009-January/520733.html
+    if (type->tp_bases) {
+        for (int i = 0, size = PyTuple_GET_SIZE(type->tp_bases); i < size; ++i) {
+            auto base = reinterpret_cast<PyTypeObject *>(PyTuple_GET_ITEM(type->tp_bases, i));
+            if (PyObject_TypeCheck(base, SbkObjectType_TypeF())) {
+                if (const QVariantTypeInfo *info = QVariant_typeInfo(base))
+                    return info;
             }
         }
-        else if (type->tp_base) {
-            return QVariant_resolveMetaType(type->tp_base, typeId);
+    }
+    else if (type->tp_base && PyObject_TypeCheck(type->tp_base, SbkObjectType_TypeF())) {
+        return QVariant_typeInfo(type->tp_base);
+    }
+    return nullptr;
+}
+
+static const QVariantTypeInfo *QVariant_resolveTypeInfo(PyTypeObject *type)
+{
+    auto sbkType = reinterpret_cast<SbkObjectType *>(type);
+    const char *typeName = Shiboken::ObjectType::getOriginalName(sbkType);
+    if (!typeName)
+        return nullptr;
+    const bool valueType = '*' != typeName[qstrlen(typeName) - 1];
+    // Do not convert user type of value
+    if (valueType && Shiboken::ObjectType::isUserType(type))
+        return nullptr;
+    // User types are named after their first wrapper base class.
+    if (Shiboken::ObjectType::isUserType(type))
+        return QVariant_baseTypeInfo(type);
+    int typeId = QMetaType::type(typeName);
+    if (typeId) {
+        QVariant_typeInfoStorage.push_back({typeName, typeId,
+                                            Shiboken::Conversions::SpecificConverter(typeName)});
+        return &QVariant_typeInfoStorage.back();
+    }
+    // Do not resolve types to value type
+    if (valueType)
+        return nullptr;
+    return QVariant_baseTypeInfo(type);
+}
+
+// Returns the metatype of a wrapper type or nullptr if it has none.
+static const QVariantTypeInfo *QVariant_typeInfo(PyTypeObject *type)
+{
+    if (Shiboken::ObjectType::isUserType(type))
+        return QVariant_resolveTypeInfo(type);
+    auto it = QVariant_typeInfos.find(type);
+    if (it == QVariant_typeInfos.end())
+        it = QVariant_typeInfos.emplace(type, QVariant_resolveTypeInfo(type)).first;
+    return it->second;
+}
+
+static const char *QVariant_resolveMetaType(PyTypeObject *type, int *typeId)
+{
+    if (PyObject_TypeCheck(type, SbkObjectType_TypeF())) {
+        if (const QVariantTypeInfo *info = QVariant_typeInfo(type)) {
+            *typeId = info->typeId;
+            return info->typeName;
         }
     }
     *typeId = 0;
     return nullptr;
 }
+
+// Converters of the metatypes held by QVariants returned to Python, looked up
+// by the metatype name once. Converters are never unregistered.
+static Shiboken::Conversions::SpecificConverter *QVariant_converter(int typeId)
+{
+    static std::unordered_map<int, Shiboken::Conversions::SpecificConverter> converters;
+    auto it = converters.find(typeId);
+    if (it == converters.end()) {
+        Shiboken::Conversions::SpecificConverter converter(QMetaType::typeName(typeId));
+        if (!converter)
+            return nullptr;
+        it = converters.emplace(typeId, converter).first;
+    }
+    return &it->second;
+}
+
+// Converts the most common Python types without going through the converter
+// lookup. Returns false if the generic conversion is needed.
+static bool QVariant_convertBuiltin(PyObject *pyIn, QVariant *out)
+{
+    if (pyIn == Py_None) {
+        *out = QVariant();
+    } else if (PyBool_Check(pyIn)) {
+        *out = QVariant(pyIn == Py_True);
+    } else if (PyUnicode_CheckExact(pyIn)) {
+        *out = QVariant(PySide::pyUnicodeToQString(pyIn));
+    } else if (PyFloat_CheckExact(pyIn)) {
+        *out = QVariant(PyFloat_AsDouble(pyIn));
+    } else if (PyLong_CheckExact(pyIn)) {
+        int overflow = 0;
+        const long long value = PyLong_AsLongLongAndOverflow(pyIn, &overflow);
+        if (overflow != 0)
+            return false;
+        // PYSIDE-1250: For QVariant, if the type fits into an int; use int preferably.
+        if (value >= std::numeric_limits<int>::min() && value <= std::numeric_limits<int>::max())
+            *out = QVariant(int(value));
+        else
+            *out = QVariant(qlonglong(value));
+    } else {
+        return false;
+    }
+    return true;
+}
+
+static QVariant QVariant_toCpp(PyObject *pyIn)
+{
+    QVariant result;
+    if (!QVariant_convertBuiltin(pyIn, &result))
+        result = %CONVERTTOCPP[QVariant](pyIn);
+    return result;
+}
+
 static QVariant QVariant_convertToValueList(PyObject *list)
 {
     if (PySequence_Size(list) < 0) {
@@ -221,7 +319,34 @@ static bool QVariant_isStringList(PyObject *list)
     const Py_ssize_t size = PySequence_Fast_GET_SIZE(fast.object());
     for (Py_ssize_t i = 0; i < size; ++i) {
         PyObject *item = PySequence_Fast_GET_ITEM(fast.object(), i);
-        if (!%CHECKTYPE[QString](item))
+        if (!PyUnicode_CheckExact(item) && !%CHECKTYPE[QString](item))
+            return false;
+    }
+    return true;
+}
+// Converts a sequence of strings in a single pass, returns false as soon as
+// an element is not a string.
+static bool QVariant_convertToStringList(PyObject *list, QStringList *result)
+{
+    if (!PySequence_Check(list))
+        return false;
+
+    if (PySequence_Size(list) < 0) {
+        // clear the error if < 0 which means no length at all
+        PyErr_Clear();
+        return false;
+    }
+
+    Shiboken::AutoDecRef fast(PySequence_Fast(list, "Failed to convert QVariantList"));
+    const Py_ssize_t size = PySequence_Fast_GET_SIZE(fast.object());
+    result->reserve(int(size));
+    for (Py_ssize_t i = 0; i < size; ++i) {
+        PyObject *item = PySequence_Fast_GET_ITEM(fast.object(), i);
+        if (PyUnicode_CheckExact(item))
+            result->append(PySide::pyUnicodeToQString(item));
+        else if (%CHECKTYPE[QString](item))
+            result->append(%CONVERTTOCPP[QString](item));
+        else
             return false;
     }
     return true;
@@ -237,17 +362,16 @@ static QVariant QVariant_convertToVariantMap(PyObject *map)
     QMap<QString,QVariant> ret;
     while (PyDict_Next(map, &pos, &key, &value)) {
         QString cppKey = %CONVERTTOCPP[QString](key);
-        QVariant cppValue = %CONVERTTOCPP[QVariant](value);
+        QVariant cppValue = QVariant_toCpp(value);
         ret.insert(cppKey, cppValue);
     }
     return QVariant(ret);
 }
 static QVariant QVariant_convertToVariantList(PyObject *list)
 {
-    if (QVariant_isStringList(list)) {
-        QList<QString > lst = %CONVERTTOCPP[QList<QString>](list);
-        return QVariant(QStringList(lst));
-    }
+    QStringList stringList;
+    if (QVariant_convertToStringList(list, &stringList))
+        return QVariant(stringList);
     QVariant valueList = QVariant_convertToValueList(list);
     if (valueList.isValid())
         return valueList;
@@ -261,10 +385,10 @@ static QVariant QVariant_convertToVariantList(PyObject *list)
     QList<QVariant> lst;
     Shiboken::AutoDecRef fast(PySequence_Fast(list, "Failed to convert QVariantList"));
     const Py_ssize_t size = PySequence_Fast_GET_SIZE(fast.object());
+    lst.reserve(int(size));
     for (Py_ssize_t i = 0; i < size; ++i) {
         PyObject *pyItem = PySequence_Fast_GET_ITEM(fast.object(), i);
-        QVariant item = %CONVERTTOCPP[QVariant](pyItem);
-        lst.append(item);
+        lst.append(QVariant_toCpp(pyItem));
     }
     return QVariant(lst);
 }
@@ -593,6 +717,20 @@ Py_END_ALLOW_THREADS
 PySide::runCleanupFunctions();
 // @snippet moduleshutdown
 
+// @snippet qstringcache-setcapacity
+PySide::setQStringCacheCapacity(%1);
+// @snippet qstringcache-setcapacity
+
+// @snippet qstringcache-statistics
+const PySide::QStringCacheStatistics statistics = PySide::qStringCacheStatistics();
+%PYARG_0 = Py_BuildValue("{s:L,s:L,s:L,s:i,s:i}",
+                         "hits", static_cast<long long>(statistics.hits),
+                         "misses", static_cast<long long>(statistics.misses),
+                         "evictions", static_cast<long long>(statistics.evictions),
+                         "size", statistics.size,
+                         "capacity", statistics.capacity);
+// @snippet qstringcache-statistics
+
 // @snippet qt-qenum
 %PYARG_0 = PySide::QEnum::QEnumMacro(%1, false);
 // @snippet qt-qenum
@@ -961,7 +1099,7 @@ if (PyIndex_Check(_key)) {
             PyErr_SetString(PyExc_ValueError, "bytearray must be of size 1");
             return -1;
         }
-    } else if (reinterpret_cast<PyTypeObject *>(Py_TYPE(_value)) == reinterpret_cast<PyTypeObject *>(SbkPySide2_QtCoreTypes[SBK_QBYTEARRAY_IDX])) {
+    } else if (reinterpret_cast<PyTypeObject *>(Py_TYPE(_value)) == Shiboken::SbkType<QByteArray>()) {
         if (PyObject_Length(_value) != 1) {
             PyErr_SetString(PyExc_ValueError, "QByteArray must be of size 1");
             return -1;
@@ -1003,7 +1141,7 @@ if (PyIndex_Check(_key)) {
     if (_value == nullptr || _value == Py_None) {
         ba = QByteArray();
         value_length = 0;
-    } else if (!(PyBytes_Check(_value) || PyByteArray_Check(_value) || reinterpret_cast<PyTypeObject *>(Py_TYPE(_value)) == reinterpret_cast<PyTypeObject *>(SbkPySide2_QtCoreTypes[SBK_QBYTEARRAY_IDX]))) {
+    } else if (!(PyBytes_Check(_value) || PyByteArray_Check(_value) || reinterpret_cast<PyTypeObject *>(Py_TYPE(_value)) == Shiboken::SbkType<QByteArray>())) {
         PyErr_Format(PyExc_TypeError, "bytes, bytearray or QByteArray is required, not %.200s", Py_TYPE(_value)->tp_name);
         return -1;
     } else {
@@ -1713,27 +1851,7 @@ Py_END_ALLOW_THREADS
 // @snippet conversion-pylong-quintptr
 
 // @snippet conversion-pyunicode
-#ifndef Py_LIMITED_API
-Py_UNICODE *unicode = PyUnicode_AS_UNICODE(%in);
-#  if defined(Py_UNICODE_WIDE)
-// cast as Py_UNICODE can be a different type
-#    if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
-%out = QString::fromUcs4(reinterpret_cast<const char32_t *>(unicode));
-#    else
-%out = QString::fromUcs4(reinterpret_cast<const uint *>(unicode));
-#    endif // Qt 6
-#  else // Py_UNICODE_WIDE
-#    if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
-%out = QString::fromUtf16(reinterpret_cast<const char16_t *>(unicode), PepUnicode_GetLength(%in));
-#    else
-%out = QString::fromUtf16(reinterpret_cast<const ushort *>(unicode), PepUnicode_GetLength(%in));
-#    endif // Qt 6
-# endif
-#else
-wchar_t *temp = PyUnicode_AsWideCharString(%in, NULL);
-%out = QString::fromWCharArray(temp);
-PyMem_Free(temp);
-#endif
+%out = PySide::pyUnicodeToQString(%in);
 // @snippet conversion-pyunicode
 
 // @snippet conversion-pystring
@@ -1783,15 +1901,14 @@ double in = %CONVERTTOCPP[double](%in);
 
 // @snippet conversion-sbkobject
 // a class supported by QVariant?
-int typeCode;
-const char *typeName = QVariant_resolveMetaType(Py_TYPE(%in), &typeCode);
-if (!typeCode || !typeName) {
+const QVariantTypeInfo *typeInfo = QVariant_typeInfo(Py_TYPE(%in));
+if (!typeInfo) {
     // If the type was not encountered, return a default PyObjectWrapper
     %out = QVariant::fromValue(PySide::PyObjectWrapper(%in));
 }
 else {
-    QVariant var(typeCode, nullptr);
-    Shiboken::Conversions::SpecificConverter converter(typeName);
+    QVariant var(typeInfo->typeId, nullptr);
+    Shiboken::Conversions::SpecificConverter converter = typeInfo->converter;
     converter.toCpp(pyIn, var.data());
     %out = var;
 }
@@ -1921,17 +2038,11 @@ return PyLong_FromUnsignedLong(%in);
 // @snippet return-pylong-quintptr
 
 // @snippet return-pyunicode
-QByteArray ba = %in.toUtf8();
-return PyUnicode_FromStringAndSize(ba.constData(), ba.size());
+return PySide::qStringToPyUnicode(%in);
 // @snippet return-pyunicode
 
 // @snippet return-pyunicode-qstringref
- const int N = %in.length();
- wchar_t *str = new wchar_t[N];
- %in.toString().toWCharArray(str);
- PyObject *%out = PyUnicode_FromWideChar(str, N);
- delete[] str;
- return %out;
+return PySide::qStringToPyUnicode(%in.unicode(), %in.size());
 // @snippet return-pyunicode-qstringref
 
 // @snippet return-pyunicode-qchar
@@ -1940,28 +2051,39 @@ return PyUnicode_FromWideChar(&c, 1);
 // @snippet return-pyunicode-qchar
 
 // @snippet return-qvariant
-if (!%in.isValid())
+const int typeId = %in.userType();
+switch (typeId) {
+case QMetaType::UnknownType:
     Py_RETURN_NONE;
-
-if (qstrcmp(%in.typeName(), "QVariantList") == 0) {
+case QMetaType::Bool:
+    return PyBool_FromLong(%in.toBool());
+case QMetaType::Int: {
+    const int var = %in.toInt();
+    return %CONVERTTOPYTHON[int](var);
+}
+case QMetaType::Double:
+    return PyFloat_FromDouble(%in.toDouble());
+case QMetaType::QString:
+    return PySide::qStringToPyUnicode(%in.toString());
+case QMetaType::QVariantList: {
     QList<QVariant> var = %in.value<QVariantList>();
     return %CONVERTTOPYTHON[QList<QVariant>](var);
 }
-
-if (qstrcmp(%in.typeName(), "QStringList") == 0) {
+case QMetaType::QStringList: {
     QStringList var = %in.value<QStringList>();
     return %CONVERTTOPYTHON[QList<QString>](var);
 }
-
-if (qstrcmp(%in.typeName(), "QVariantMap") == 0) {
+case QMetaType::QVariantMap: {
     QMap<QString, QVariant> var = %in.value<QVariantMap>();
     return %CONVERTTOPYTHON[QMap<QString, QVariant>](var);
 }
+default:
+    break;
+}
 
-Shiboken::Conversions::SpecificConverter converter(cppInRef.typeName());
-if (converter) {
+if (Shiboken::Conversions::SpecificConverter *converter = QVariant_converter(typeId)) {
    void *ptr = cppInRef.data();
-   return converter.toPython(ptr);
+   return converter->toPython(ptr);
 }
 PyErr_Format(PyExc_RuntimeError, "Can't find converter for '%s'.", %in.typeName());
 return 0;
@@ -144,22 +144,155 @@ for (int i = 0, i_max = %CPPSELF.count(); i < i_max; ++i){
 // @snippet qpixmap
 
 // @snippet qimage-constbits
-%PYARG_0 = Shiboken::Buffer::newObject(%CPPSELF.%FUNCTION_NAME(), %CPPSELF.byteCount());
+// The buffers returned by bits(), constBits(), scanLine() and constScanLine()
+// have the image as exporter and keep it alive. They still dangle once the
+// image data is reallocated or detached; this is documented for QImage.
+%PYARG_0 = Shiboken::Buffer::newObject(const_cast<uchar *>(%CPPSELF.%FUNCTION_NAME()), %CPPSELF.byteCount(),
+                                       Shiboken::Buffer::ReadOnly, %PYSELF);
 // @snippet qimage-constbits
 
 // @snippet qimage-bits
 // byteCount() is only available on Qt4.7, so we use bytesPerLine * height
-%PYARG_0 = Shiboken::Buffer::newObject(%CPPSELF.%FUNCTION_NAME(), %CPPSELF.bytesPerLine() * %CPPSELF.height(), Shiboken::Buffer::ReadWrite);
+%PYARG_0 = Shiboken::Buffer::newObject(%CPPSELF.%FUNCTION_NAME(), %CPPSELF.bytesPerLine() * %CPPSELF.height(),
+                                       Shiboken::Buffer::ReadWrite, %PYSELF);
 // @snippet qimage-bits
 
 // @snippet qimage-constscanline
-%PYARG_0 = Shiboken::Buffer::newObject(%CPPSELF.%FUNCTION_NAME(%1), %CPPSELF.bytesPerLine());
+%PYARG_0 = Shiboken::Buffer::newObject(const_cast<uchar *>(%CPPSELF.%FUNCTION_NAME(%1)), %CPPSELF.bytesPerLine(),
+                                       Shiboken::Buffer::ReadOnly, %PYSELF);
 // @snippet qimage-constscanline
 
 // @snippet qimage-scanline
-%PYARG_0 = Shiboken::Buffer::newObject(%CPPSELF.%FUNCTION_NAME(%1), %CPPSELF.bytesPerLine(), Shiboken::Buffer::ReadWrite);
+%PYARG_0 = Shiboken::Buffer::newObject(%CPPSELF.%FUNCTION_NAME(%1), %CPPSELF.bytesPerLine(),
+                                       Shiboken::Buffer::ReadWrite, %PYSELF);
 // @snippet qimage-scanline
 
+// @snippet qimage-buffer-cleanup
+// The buffer passed to a QImage constructor stays exported until the last
+// copy of the image is destroyed. This keeps the object alive and prevents
+// it from reallocating its memory (resizing a bytearray fails).
+#ifdef IS_PY3K
+static bool imageBufferAcquire(PyObject *pyObj, uchar **data, void **info)
+{
+    auto *buffer = new Py_buffer;
+    if (PyObject_GetBuffer(pyObj, buffer, PyBUF_ND) != 0) {
+        delete buffer;
+        return false;
+    }
+    *data = reinterpret_cast<uchar *>(buffer->buf);
+    *info = buffer;
+    return true;
+}
+
+static void imageBufferCleanup(void *info)
+{
+    Shiboken::GilState state;
+    auto *buffer = reinterpret_cast<Py_buffer *>(info);
+    PyBuffer_Release(buffer);
+    delete buffer;
+}
+#else
+// The buffer objects of Python 2 only provide the old buffer protocol, which
+// has no export; a reference to the object is held instead.
+static bool imageBufferAcquire(PyObject *pyObj, uchar **data, void **info)
+{
+    *data = reinterpret_cast<uchar *>(Shiboken::Buffer::getPointer(pyObj));
+    if (PyErr_Occurred())
+        return false;
+    Py_INCREF(pyObj);
+    *info = pyObj;
+    return true;
+}
+
+static void imageBufferCleanup(void *info)
+{
+    Shiboken::GilState state;
+    Py_DECREF(reinterpret_cast<PyObject *>(info));
+}
+#endif
+// @snippet qimage-buffer-cleanup
+
+// @snippet qimage-array-interface
+// NumPy array interface (version 3) exposing the pixels without copying.
+// NumPy keeps a reference to the image as base of the array; the array is
+// invalidated when the image data is reallocated.
+if (%CPPSELF.isNull()) {
+    PyErr_SetString(PyExc_ValueError, "A null image has no pixel data.");
+    return nullptr;
+}
+const char *endian = Q_BYTE_ORDER == Q_LITTLE_ENDIAN ? "<" : ">";
+const Py_ssize_t height = %CPPSELF.height();
+const Py_ssize_t width = %CPPSELF.width();
+const Py_ssize_t bytesPerLine = %CPPSELF.bytesPerLine();
+PyObject *shape = nullptr;
+PyObject *strides = nullptr;
+QByteArray typeStr = "|u1";
+switch (%CPPSELF.depth()) {
+case 8:
+    shape = Py_BuildValue("(nn)", height, width);
+    strides = Py_BuildValue("(nn)", bytesPerLine, Py_ssize_t(1));
+    break;
+case 16:
+    typeStr = QByteArray(endian) + "u2";
+    shape = Py_BuildValue("(nn)", height, width);
+    strides = Py_BuildValue("(nn)", bytesPerLine, Py_ssize_t(2));
+    break;
+case 24:
+    shape = Py_BuildValue("(nnn)", height, width, Py_ssize_t(3));
+    strides = Py_BuildValue("(nnn)", bytesPerLine, Py_ssize_t(3), Py_ssize_t(1));
+    break;
+case 32:
+    switch (%CPPSELF.format()) {
+    case QImage::Format_RGB32:
+    case QImage::Format_ARGB32:
+    case QImage::Format_ARGB32_Premultiplied:
+    case QImage::Format_RGBX8888:
+    case QImage::Format_RGBA8888:
+    case QImage::Format_RGBA8888_Premultiplied:
+        // 8 bit channels in memory order (BGRA for ARGB32 on little endian)
+        shape = Py_BuildValue("(nnn)", height, width, Py_ssize_t(4));
+        strides = Py_BuildValue("(nnn)", bytesPerLine, Py_ssize_t(4), Py_ssize_t(1));
+        break;
+    default:
+        typeStr = QByteArray(endian) + "u4";
+        shape = Py_BuildValue("(nn)", height, width);
+        strides = Py_BuildValue("(nn)", bytesPerLine, Py_ssize_t(4));
+        break;
+    }
+    break;
+case 64:
+    typeStr = QByteArray(endian) + "u2";
+    shape = Py_BuildValue("(nnn)", height, width, Py_ssize_t(4));
+    strides = Py_BuildValue("(nnn)", bytesPerLine, Py_ssize_t(8), Py_ssize_t(2));
+    break;
+default:
+    // Monochrome images are exposed as the bytes of each line.
+    shape = Py_BuildValue("(nn)", height, bytesPerLine);
+    strides = Py_BuildValue("(nn)", bytesPerLine, Py_ssize_t(1));
+    break;
+}
+%PYARG_0 = Py_BuildValue("{s:N,s:N,s:s,s:(NO),s:i}",
+                         "shape", shape, "strides", strides, "typestr", typeStr.constData(),
+                         "data", PyLong_FromVoidPtr(%CPPSELF.bits()), Py_False,
+                         "version", 3);
+// @snippet qimage-array-interface
+
+// @snippet qpolygon-array-interface
+// NumPy array interface (version 3) exposing the points without copying, as
+// an array of shape (n, 2). NumPy keeps the polygon alive as base of the
+// array, but the data pointer dangles once the polygon reallocates its points
+// (append(), resize(), ...). This is documented for QPolygon and QPolygonF.
+using Coordinate = decltype(%CPPSELF.constData()->x());
+const QByteArray typeStr = QByteArray(Q_BYTE_ORDER == Q_LITTLE_ENDIAN ? "<" : ">")
+    + (std::is_floating_point<Coordinate>::value ? 'f' : 'i')
+    + QByteArray::number(int(sizeof(Coordinate)));
+%PYARG_0 = Py_BuildValue("{s:(ni),s:s,s:(NO),s:i}",
+                         "shape", Py_ssize_t(%CPPSELF.size()), 2,
+                         "typestr", typeStr.constData(),
+                         "data", PyLong_FromVoidPtr(%CPPSELF.data()), Py_False,
+                         "version", 3);
+// @snippet qpolygon-array-interface
+
 // @snippet qcolor-setstate
 Shiboken::AutoDecRef func(PyObject_GetAttr(%PYSELF, PyTuple_GET_ITEM(%1, 0)));
 PyObject *args = PyTuple_GET_ITEM(%1, 1);
@@ -451,15 +584,23 @@ QPoint p(%CPPSELF.%FUNCTION_NAME(%1));
 // @snippet qmatrix-map-point
 
 // @snippet qmatrix4x4
-// PYSIDE-795: All PySequences can be made iterable with PySequence_Fast.
-Shiboken::AutoDecRef seq(PySequence_Fast(%PYARG_1, "Can't turn into sequence"));
-if (PySequence_Size(seq) == 16) {
-    float values[16];
-    for (int i=0; i < 16; ++i) {
-        PyObject *pv = PySequence_Fast_GET_ITEM(seq.object(), i);
-        values[i] = PyFloat_AsDouble(pv);
+float values[16];
+bool valuesOk = false;
+// Buffers of 16 floats (array.array('f'), NumPy float32) are copied directly.
+if (Shiboken::Buffer::itemCount(%PYARG_1, "f", Py_ssize_t(sizeof(float))) == 16) {
+    valuesOk = Shiboken::Buffer::copyData(%PYARG_1, values, Py_ssize_t(sizeof(values)));
+} else {
+    // PYSIDE-795: All PySequences can be made iterable with PySequence_Fast.
+    Shiboken::AutoDecRef seq(PySequence_Fast(%PYARG_1, "Can't turn into sequence"));
+    if (PySequence_Size(seq) == 16) {
+        for (int i=0; i < 16; ++i) {
+            PyObject *pv = PySequence_Fast_GET_ITEM(seq.object(), i);
+            values[i] = PyFloat_AsDouble(pv);
+        }
+        valuesOk = true;
     }
-
+}
+if (valuesOk) {
     %0 = new %TYPE(values[0], values[1], values[2], values[3],
                    values[4], values[5], values[6], values[7],
                    values[8], values[9], values[10], values[11],
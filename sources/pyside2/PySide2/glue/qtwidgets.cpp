@@ -229,10 +229,11 @@ if (_widget) {
 void addLayoutOwnership(QLayout *layout, QLayoutItem *item);
 void removeLayoutOwnership(QLayout *layout, QWidget *widget);
 
-inline QByteArray retrieveObjectName(PyObject *obj)
+// The key of the references an orphan layout keeps to its children.
+static inline int layoutChildrenKeyId()
 {
-    Shiboken::AutoDecRef objName(PyObject_Str(obj));
-    return Shiboken::String::toCString(objName);
+    static const int result = Shiboken::Object::referenceKeyId("__layout_children__");
+    return result;
 }
 
 inline void addLayoutOwnership(QLayout *layout, QWidget *widget)
@@ -250,7 +251,7 @@ inline void addLayoutOwnership(QLayout *layout, QWidget *widget)
     if (!lw && !pw) {
         //keep the reference while the layout is orphan
         Shiboken::AutoDecRef pyParent(%CONVERTTOPYTHON[QWidget *](layout));
-        Shiboken::Object::keepReference(reinterpret_cast<SbkObject *>(pyParent.object()), retrieveObjectName(pyParent).data(), pyChild, true);
+        Shiboken::Object::keepReference(reinterpret_cast<SbkObject *>(pyParent.object()), layoutChildrenKeyId(), pyChild, true);
     } else {
         if (!lw)
             lw = pw;
@@ -268,7 +269,7 @@ inline void addLayoutOwnership(QLayout *layout, QLayout *other)
         Shiboken::AutoDecRef pyParent(%CONVERTTOPYTHON[QLayout *](layout));
         Shiboken::AutoDecRef pyChild(%CONVERTTOPYTHON[QLayout *](other));
         Shiboken::Object::keepReference(reinterpret_cast<SbkObject *>(pyParent.object()),
-                                        retrieveObjectName(pyParent).data(), pyChild, true);
+                                        layoutChildrenKeyId(), pyChild, true);
         return;
     }
 
@@ -310,7 +311,7 @@ static void removeWidgetFromLayout(QLayout *layout, QWidget *widget)
         Shiboken::AutoDecRef pyParent(%CONVERTTOPYTHON[QWidget *](layout));
         Shiboken::AutoDecRef pyChild(%CONVERTTOPYTHON[QWidget *](widget));
         Shiboken::Object::removeReference(reinterpret_cast<SbkObject *>(pyParent.object()),
-                                          retrieveObjectName(pyParent).data(), pyChild);
+                                          layoutChildrenKeyId(), pyChild);
     } else {
         //give the ownership to parent
         Shiboken::AutoDecRef pyParent(%CONVERTTOPYTHON[QWidget *](parent));
@@ -451,10 +452,11 @@ for (int i = 0, count = %CPPSELF.count(); i < count; ++i) {
 // @snippet qlistwidget-clear
 
 // @snippet qwidget-glue
-static QString retrieveObjectName(PyObject *obj)
+// The key of the references an orphan layout keeps to its children.
+static inline int layoutChildrenKeyId()
 {
-    Shiboken::AutoDecRef objName(PyObject_Str(obj));
-    return QString(Shiboken::String::toCString(objName));
+    static const int result = Shiboken::Object::referenceKeyId("__layout_children__");
+    return result;
 }
 
 
@@ -484,7 +486,7 @@ static inline void qwidgetReparentLayout(QWidget *parent, QLayout *layout)
     Shiboken::Object::setParent(pyParent, pyChild);
     //remove previous references
     Shiboken::Object::keepReference(reinterpret_cast<SbkObject *>(pyChild.object()),
-                                    qPrintable(retrieveObjectName(pyChild)), Py_None);
+                                    layoutChildrenKeyId(), Py_None);
 }
 
 static inline void qwidgetSetLayout(QWidget *self, QLayout *layout)
@@ -122,23 +122,83 @@ macro(create_pyside_module)
         install(FILES ${module_GLUE_SOURCES} DESTINATION share/PySide2${pyside2_SUFFIX}/typesystems/glue)
     endif()
 
-    add_custom_command( OUTPUT "${CMAKE_CURRENT_BINARY_DIR}/mjb_rejected_classes.log"
-                        BYPRODUCTS ${${module_SOURCES}}
-                        COMMAND Shiboken2::shiboken2 ${GENERATOR_EXTRA_FLAGS}
-                        "${pyside2_BINARY_DIR}/${module_NAME}_global.h"
-                        --include-paths=${shiboken_include_dirs}
-                        ${shiboken_framework_include_dirs_option}
-                        --typesystem-paths=${pyside_binary_dir}${PATH_SEP}${pyside2_SOURCE_DIR}${PATH_SEP}${${module_TYPESYSTEM_PATH}}
-                        --output-directory=${CMAKE_CURRENT_BINARY_DIR}
-                        --license-file=${CMAKE_CURRENT_SOURCE_DIR}/../licensecomment.txt
-                        ${typesystem_path}
-                        --api-version=${SUPPORTED_QT_VERSION}
-                        --drop-type-entries="${dropped_entries}"
-                        DEPENDS ${total_type_system_files}
-                                ${module_GLUE_SOURCES}
-                                ${${module_NAME}_glue_dependency}
-                        WORKING_DIRECTORY ${CMAKE_CURRENT_SOURCE_DIR}
-                        COMMENT "Running generator for ${module_NAME}...")
+    # In batch mode, a project file is written instead of running the generator
+    # per module. The modules are grouped into chains, each generated by one
+    # generator process which reuses the parsed type systems of a module for the
+    # next one (see PySide2/CMakeLists.txt). A module continues the chain of a
+    # dependency if that dependency is the last module of its chain, otherwise it
+    # starts a new chain. Each module only waits for the generation of its chain.
+    if (GENERATOR_BATCH)
+        set(project_file "${CMAKE_CURRENT_BINARY_DIR}/${module_NAME}_project.txt")
+        set(project_file_content "[generator-project]\n")
+        foreach(flag ${GENERATOR_EXTRA_FLAGS})
+            string(REGEX REPLACE "^--" "" flag "${flag}")
+            string(REPLACE "=" " = " flag "${flag}")
+            string(APPEND project_file_content "${flag}\n")
+        endforeach()
+        if(${module_DROPPED_ENTRIES})
+            string(APPEND project_file_content "drop-type-entries = ${${module_DROPPED_ENTRIES}}\n")
+        endif()
+        string(APPEND project_file_content
+               "header-file = ${pyside2_BINARY_DIR}/${module_NAME}_global.h\n"
+               "typesystem-file = ${typesystem_path}\n"
+               "include-path = ${shiboken_include_dirs}\n"
+               "typesystem-path = ${CMAKE_CURRENT_SOURCE_DIR}${PATH_SEP}${pyside_binary_dir}${PATH_SEP}${pyside2_SOURCE_DIR}${PATH_SEP}${${module_TYPESYSTEM_PATH}}\n"
+               "output-directory = ${CMAKE_CURRENT_BINARY_DIR}\n"
+               "license-file = ${CMAKE_CURRENT_SOURCE_DIR}/../licensecomment.txt\n"
+               "api-version = ${SUPPORTED_QT_VERSION}\n")
+        if(CMAKE_HOST_APPLE)
+            string(APPEND project_file_content
+                   "framework-include-path = ${shiboken_framework_include_dirs}\n")
+        endif()
+        file(WRITE "${project_file}" "${project_file_content}")
+
+        set(generator_chain "${module_NAME}")
+        foreach(dep ${${module_DEPS}})
+            get_property(dep_chain GLOBAL PROPERTY pyside2_generator_chain_${dep})
+            if(dep_chain)
+                get_property(dep_chain_tail GLOBAL PROPERTY pyside2_generator_chain_tail_${dep_chain})
+                if("${dep_chain_tail}" STREQUAL "${dep}")
+                    set(generator_chain "${dep_chain}")
+                    break()
+                endif()
+            endif()
+        endforeach()
+        set_property(GLOBAL PROPERTY pyside2_generator_chain_${module_NAME} "${generator_chain}")
+        set_property(GLOBAL PROPERTY pyside2_generator_chain_tail_${generator_chain} "${module_NAME}")
+        if("${generator_chain}" STREQUAL "${module_NAME}")
+            set_property(GLOBAL APPEND PROPERTY pyside2_generator_chains "${generator_chain}")
+        endif()
+        set_property(GLOBAL APPEND PROPERTY pyside2_generator_project_files_${generator_chain}
+                     "${project_file}")
+        set_property(GLOBAL APPEND PROPERTY pyside2_generator_outputs_${generator_chain}
+                     "${CMAKE_CURRENT_BINARY_DIR}/mjb_rejected_classes.log")
+        set_property(GLOBAL APPEND PROPERTY pyside2_generator_sources_${generator_chain}
+                     ${${module_SOURCES}})
+        set_property(GLOBAL APPEND PROPERTY pyside2_generator_depends_${generator_chain}
+                     ${total_type_system_files}
+                     ${module_GLUE_SOURCES}
+                     ${${module_NAME}_glue_dependency})
+        set_source_files_properties(${${module_SOURCES}} PROPERTIES GENERATED TRUE)
+    else()
+        add_custom_command( OUTPUT "${CMAKE_CURRENT_BINARY_DIR}/mjb_rejected_classes.log"
+                            BYPRODUCTS ${${module_SOURCES}}
+                            COMMAND Shiboken2::shiboken2 ${GENERATOR_EXTRA_FLAGS}
+                            "${pyside2_BINARY_DIR}/${module_NAME}_global.h"
+                            --include-paths=${shiboken_include_dirs}
+                            ${shiboken_framework_include_dirs_option}
+                            --typesystem-paths=${pyside_binary_dir}${PATH_SEP}${pyside2_SOURCE_DIR}${PATH_SEP}${${module_TYPESYSTEM_PATH}}
+                            --output-directory=${CMAKE_CURRENT_BINARY_DIR}
+                            --license-file=${CMAKE_CURRENT_SOURCE_DIR}/../licensecomment.txt
+                            ${typesystem_path}
+                            --api-version=${SUPPORTED_QT_VERSION}
+                            --drop-type-entries="${dropped_entries}"
+                            DEPENDS ${total_type_system_files}
+                                    ${module_GLUE_SOURCES}
+                                    ${${module_NAME}_glue_dependency}
+                            WORKING_DIRECTORY ${CMAKE_CURRENT_SOURCE_DIR}
+                            COMMENT "Running generator for ${module_NAME}...")
+    endif()
 
     include_directories(${module_NAME} ${${module_INCLUDE_DIRS}} ${pyside2_SOURCE_DIR})
     add_library(${module_NAME} MODULE ${${module_SOURCES}}
@@ -158,7 +218,11 @@ macro(create_pyside_module)
     if(${module_DEPS})
         add_dependencies(${module_NAME} ${${module_DEPS}})
     endif()
-    create_generator_target(${module_NAME})
+    if (GENERATOR_BATCH)
+        add_dependencies(${module_NAME} ${generator_chain}_generator)
+    else()
+        create_generator_target(${module_NAME})
+    endif()
 
     # build type hinting stubs
 
@@ -46,6 +46,8 @@
 
 #include <QtCore/QtGlobal>
 
+#include <cstring>
+
 //////////////////////////////////////////////////////////////////////////////
 //
 // PYSIDE-1019: Support switchable extensions
@@ -101,17 +103,20 @@ with our own version, again in SbkObjectType, replacing the default of
 PyType_Type.
 
 Now we can exchange the dict with a customized version.
-We have our own derived type `ChameleonDict` with additional attributes.
-These allow us to create a ring of dicts which can be rotated to the actual
-needed dict version:
-
-Every dict has a field `select_id` which is selected by the `from __feature__`
-import. The dicts are cyclic connected by the `dict_ring` field.
+We have our own derived type `ChameleonDict` which marks the dicts that
+were already replaced. The dicts of a class are kept in a small table
+indexed by the `select_id` which is selected by the `from __feature__`
+import. The first entry is the default dict with select id 0.
 
 When a class dict is required, now always `SelectFeatureSet` is called, which
 looks into the `__name__` attribute of the active module and decides which
-version of `tp_dict` is needed. Then the right dict is searched in the ring
-and created if not already there.
+version of `tp_dict` is needed. The select id of the current dict is cached
+in the type, so nothing happens if it is already the right one. Otherwise the
+dict is looked up in the table and created if not already there.
+
+A new dict starts as a copy of the default dict. The features then modify
+only the entries they rename or replace, instead of each feature building
+a complete copy of the dict of the previous one.
 
 Furthermore, we need to overwrite every `tp_(get|set)attro`  with a version
 that switches dicts right before looking up methods.
@@ -126,7 +131,8 @@ namespace PySide { namespace Feature {
 
 using namespace Shiboken;
 
-typedef bool(*FeatureProc)(PyTypeObject *type, PyObject *prev_dict, int id);
+// A FeatureProc modifies the entries of `dict` which change by the feature.
+typedef bool(*FeatureProc)(PyTypeObject *type, PyObject *dict, int id);
 
 static FeatureProc *featurePointer = nullptr;
 
@@ -173,7 +179,7 @@ createDerivedDictType()
     PyObject *ChameleonDict = PepRun_GetResult(R"CPP(if True:
 
         class ChameleonDict(dict):
-            __slots__ = ("dict_ring", "select_id")
+            __slots__ = ("feature_dicts",)
 
         result = ChameleonDict
 
@@ -192,32 +198,22 @@ static void ensureNewDictType()
     }
 }
 
-static inline PyObject *nextInCircle(PyObject *dict)
-{
-    // returns a borrowed ref
-    AutoDecRef next_dict(PyObject_GetAttr(dict, PyName::dict_ring()));
-    return next_dict;
-}
-
-static inline void setNextDict(PyObject *dict, PyObject *next_dict)
+static inline PyObject *getFeatureDicts(PyObject *dict)
 {
-    PyObject_SetAttr(dict, PyName::dict_ring(), next_dict);
-}
-
-static inline void setSelectId(PyObject *dict, PyObject *select_id)
-{
-    PyObject_SetAttr(dict, PyName::select_id(), select_id);
-}
-
-static inline PyObject *getSelectId(PyObject *dict)
-{
-    auto select_id = PyObject_GetAttr(dict, PyName::select_id());
-    return select_id;
+    /*
+     * Returns a borrowed ref to the table of all dicts of a type, which
+     * maps the select id to the dict. Every dict of the type references
+     * the table, so the garbage collector sees the dicts through
+     * `type->tp_dict` and they die with the type.
+     */
+    AutoDecRef feature_dicts(PyObject_GetAttr(dict, PyName::feature_dicts()));
+    return feature_dicts;
 }
 
-static inline void setCurrentSelectId(PyTypeObject *type, PyObject *select_id)
+static inline bool addFeatureDict(PyObject *feature_dicts, PyObject *dict, int id)
 {
-    SbkObjectType_SetReserved(type, PyInt_AsSsize_t(select_id));    // int/long cheating
+    return PyObject_SetAttr(dict, PyName::feature_dicts(), feature_dicts) == 0
+        && PyDict_SetItem(feature_dicts, fast_id_array[id], dict) == 0;
 }
 
 static inline void setCurrentSelectId(PyTypeObject *type, int id)
@@ -234,6 +230,15 @@ static inline PyObject *getCurrentSelectId(PyTypeObject *type)
     return fast_id_array[id];
 }
 
+static inline void setTypeDict(PyTypeObject *type, PyObject *dict, int id)
+{
+    // `type->tp_dict` owns a reference like it does without features.
+    Py_INCREF(dict);
+    Py_DECREF(type->tp_dict);
+    type->tp_dict = dict;
+    setCurrentSelectId(type, id);
+}
+
 static bool replaceClassDict(PyTypeObject *type)
 {
     /*
@@ -243,108 +248,56 @@ static bool replaceClassDict(PyTypeObject *type)
     ensureNewDictType();
     PyObject *dict = type->tp_dict;
     auto ob_ndt = reinterpret_cast<PyObject *>(new_dict_type);
-    PyObject *new_dict = PyObject_CallObject(ob_ndt, nullptr);
-    if (new_dict == nullptr || PyDict_Update(new_dict, dict) < 0)
+    AutoDecRef new_dict(PyObject_CallObject(ob_ndt, nullptr));
+    if (new_dict.isNull() || PyDict_Update(new_dict, dict) < 0)
+        return false;
+    AutoDecRef feature_dicts(PyDict_New());
+    if (feature_dicts.isNull() || !addFeatureDict(feature_dicts, new_dict, 0))
         return false;
-    // Insert the default id. Cannot fail for small numbers.
-    AutoDecRef select_id(PyInt_FromLong(0));
-    setSelectId(new_dict, select_id);
-    // insert the dict into itself as ring
-    setNextDict(new_dict, new_dict);
     // We have now an exact copy of the dict with a new type.
     // Replace `__dict__` which usually has refcount 1 (but see cyclic_test.py)
-    Py_DECREF(type->tp_dict);
-    type->tp_dict = new_dict;
+    setTypeDict(type, new_dict, 0);
     return true;
 }
 
-static bool addNewDict(PyTypeObject *type, PyObject *select_id)
+static bool moveToFeatureSet(PyTypeObject *type, int id)
 {
     /*
-     * Add a new dict to the ring and set it as `type->tp_dict`.
-     * A 'false' return is fatal.
+     * Switch to the dict of the given select id and return `true`.
+     * If not found, stay at the current dict and return `false`.
      */
-    auto dict = type->tp_dict;
-    auto ob_ndt = reinterpret_cast<PyObject *>(new_dict_type);
-    auto new_dict = PyObject_CallObject(ob_ndt, nullptr);
-    if (new_dict == nullptr)
+    PyObject *feature_dicts = getFeatureDicts(type->tp_dict);
+    PyObject *dict = PyDict_GetItem(feature_dicts, fast_id_array[id]);
+    if (dict == nullptr)
         return false;
-    setSelectId(new_dict, select_id);
-    // insert the dict into the ring
-    auto next_dict = nextInCircle(dict);
-    setNextDict(dict, new_dict);
-    setNextDict(new_dict, next_dict);
-    type->tp_dict = new_dict;
+    setTypeDict(type, dict, id);
     return true;
 }
 
-static bool moveToFeatureSet(PyTypeObject *type, PyObject *select_id)
-{
-    /*
-     * Rotate the ring to the given `select_id` and return `true`.
-     * If not found, stay at the current position and return `false`.
-     */
-    auto initial_dict = type->tp_dict;
-    auto dict = initial_dict;
-    do {
-        dict = nextInCircle(dict);
-        AutoDecRef current_id(getSelectId(dict));
-        // This works because small numbers are singleton objects.
-        if (current_id == select_id) {
-            type->tp_dict = dict;
-            setCurrentSelectId(type, select_id);
-            return true;
-        }
-    } while (dict != initial_dict);
-    type->tp_dict = initial_dict;
-    return false;
-}
-
-static bool createNewFeatureSet(PyTypeObject *type, PyObject *select_id)
+static bool createNewFeatureSet(PyTypeObject *type, int id)
 {
     /*
      * Create a new feature set.
      * A `false` return value is a fatal error.
      *
-     * A FeatureProc sees an empty `type->tp_dict` and the previous dict
-     * content in `prev_dict`. It is responsible of filling `type->tp_dict`
-     * with modified content.
+     * The new dict is a copy of the default dict. Each FeatureProc then
+     * changes the entries which are affected by its feature.
      */
-    static auto small_1 = PyInt_FromLong(255);
-    Q_UNUSED(small_1);
-    static auto small_2 = PyInt_FromLong(255);
-    Q_UNUSED(small_2);
-    // make sure that small integers are cached
-    assert(small_1 != nullptr && small_1 == small_2);
-
-    static auto zero = fast_id_array[0];
-    bool ok = moveToFeatureSet(type, zero);
-    Q_UNUSED(ok);
-    assert(ok);
-
-    AutoDecRef prev_dict(type->tp_dict);
-    Py_INCREF(prev_dict);   // keep the first ref unchanged
-    if (!addNewDict(type, select_id))
-        return false;
-    auto id = PyInt_AsSsize_t(select_id);   // int/long cheating
-    if (id == -1)
+    ImportProfile::ScopedEvent profile("feature", "__feature__", type->tp_name);
+
+    PyObject *feature_dicts = getFeatureDicts(type->tp_dict);
+    PyObject *default_dict = PyDict_GetItem(feature_dicts, fast_id_array[0]);
+    auto ob_ndt = reinterpret_cast<PyObject *>(new_dict_type);
+    AutoDecRef new_dict(PyObject_CallObject(ob_ndt, nullptr));
+    if (new_dict.isNull() || default_dict == nullptr
+        || PyDict_Update(new_dict, default_dict) < 0
+        || !addFeatureDict(feature_dicts, new_dict, id))
         return false;
-    setCurrentSelectId(type, id);
+    setTypeDict(type, new_dict, id);
     FeatureProc *proc = featurePointer;
     for (int idx = id; *proc != nullptr; ++proc, idx >>= 1) {
-        if (idx & 1) {
-            // clear the tp_dict that will get new content
-            PyDict_Clear(type->tp_dict);
-            // let the proc re-fill the tp_dict
-            if (!(*proc)(type, prev_dict, id))
-                return false;
-            // if there is still a step, prepare `prev_dict`
-            if (idx >> 1) {
-                prev_dict.reset(PyDict_Copy(type->tp_dict));
-                if (prev_dict.isNull())
-                    return false;
-            }
-        }
+        if ((idx & 1) && !(*proc)(type, new_dict, id))
+            return false;
     }
     return true;
 }
@@ -363,8 +316,12 @@ static bool SelectFeatureSetSubtype(PyTypeObject *type, PyObject *select_id)
             return false;
         }
     }
-    if (!moveToFeatureSet(type, select_id)) {
-        if (!createNewFeatureSet(type, select_id)) {
+    // The select id of the current dict is cached in the type.
+    if (getCurrentSelectId(type) == select_id)
+        return true;
+    const auto id = int(PyInt_AsSsize_t(select_id));   // int/long cheating
+    if (!moveToFeatureSet(type, id)) {
+        if (!createNewFeatureSet(type, id)) {
             Py_FatalError("failed to create a new feature set!");
             return false;
         }
@@ -418,14 +375,14 @@ void Select(PyObject *obj)
     type->tp_dict = SelectFeatureSet(type);
 }
 
-static bool feature_01_addLowerNames(PyTypeObject *type, PyObject *prev_dict, int id);
-static bool feature_02_true_property(PyTypeObject *type, PyObject *prev_dict, int id);
-static bool feature_04_addDummyNames(PyTypeObject *type, PyObject *prev_dict, int id);
-static bool feature_08_addDummyNames(PyTypeObject *type, PyObject *prev_dict, int id);
-static bool feature_10_addDummyNames(PyTypeObject *type, PyObject *prev_dict, int id);
-static bool feature_20_addDummyNames(PyTypeObject *type, PyObject *prev_dict, int id);
-static bool feature_40_addDummyNames(PyTypeObject *type, PyObject *prev_dict, int id);
-static bool feature_80_addDummyNames(PyTypeObject *type, PyObject *prev_dict, int id);
+static bool feature_01_addLowerNames(PyTypeObject *type, PyObject *dict, int id);
+static bool feature_02_true_property(PyTypeObject *type, PyObject *dict, int id);
+static bool feature_04_addDummyNames(PyTypeObject *type, PyObject *dict, int id);
+static bool feature_08_addDummyNames(PyTypeObject *type, PyObject *dict, int id);
+static bool feature_10_addDummyNames(PyTypeObject *type, PyObject *dict, int id);
+static bool feature_20_addDummyNames(PyTypeObject *type, PyObject *dict, int id);
+static bool feature_40_addDummyNames(PyTypeObject *type, PyObject *dict, int id);
+static bool feature_80_addDummyNames(PyTypeObject *type, PyObject *dict, int id);
 
 static FeatureProc featureProcArray[] = {
     feature_01_addLowerNames,
@@ -452,6 +409,7 @@ void init()
     // This function can be called multiple times.
     static bool is_initialized = false;
     if (!is_initialized) {
+        ImportProfile::ScopedEvent profile("feature", "__feature__", "init");
         fast_id_array = &_fast_id_array[1];
         for (int idx = -1; idx < 256; ++idx)
             fast_id_array[idx] = PyInt_FromLong(idx);
@@ -507,36 +465,36 @@ static PyObject *methodWithNewName(PyTypeObject *type,
     return descr;
 }
 
-static bool feature_01_addLowerNames(PyTypeObject *type, PyObject *prev_dict, int id)
+static inline bool isMethodDescriptor(PyObject *value)
+{
+    return value != nullptr
+        && (Py_TYPE(value) == PepMethodDescr_TypePtr
+            || Py_TYPE(value) == PepStaticMethod_TypePtr);
+}
+
+static bool feature_01_addLowerNames(PyTypeObject *type, PyObject *dict, int id)
 {
     /*
-     * Add objects with lower names to `type->tp_dict` from 'prev_dict`.
+     * Replace the methods of `dict` by methods with lower names.
+     * Methods whose name does not change are kept.
      */
-    PyObject *lower_dict = type->tp_dict;
-    PyObject *key, *value;
-    Py_ssize_t pos = 0;
-
-    // We first copy the things over which will not be changed:
-    while (PyDict_Next(prev_dict, &pos, &key, &value)) {
-        if (   Py_TYPE(value) != PepMethodDescr_TypePtr
-            && Py_TYPE(value) != PepStaticMethod_TypePtr) {
-            if (PyDict_SetItem(lower_dict, key, value))
-                return false;
-            continue;
-        }
-    }
-    // Then we walk over the tp_methods to get all methods and insert
-    // them with changed names.
     PyMethodDef *meth = type->tp_methods;
     if (!meth)
         return true;
 
     for (; meth != nullptr && meth->ml_name != nullptr; ++meth) {
         const char *name = String::toCString(String::getSnakeCaseName(meth->ml_name, true));
+        const bool renamed = std::strcmp(name, meth->ml_name) != 0;
+        if (!renamed && isMethodDescriptor(PyDict_GetItemString(dict, name)))
+            continue;
+        if (renamed && isMethodDescriptor(PyDict_GetItemString(dict, meth->ml_name))
+            && PyDict_DelItemString(dict, meth->ml_name) < 0) {
+            return false;
+        }
         AutoDecRef new_method(methodWithNewName(type, meth, name));
         if (new_method.isNull())
             return false;
-        if (PyDict_SetItemString(lower_dict, name, new_method) < 0)
+        if (PyDict_SetItemString(dict, name, new_method) < 0)
             return false;
     }
     return true;
@@ -588,22 +546,21 @@ static PyObject *make_snake_case(QString s, bool lower)
     return String::getSnakeCaseName(s.toLatin1().data(), lower);
 }
 
-static bool feature_02_true_property(PyTypeObject *type, PyObject *prev_dict, int id)
+static bool feature_02_true_property(PyTypeObject *type, PyObject *prop_dict, int id)
 {
     /*
      * Use the property info to create true Python property objects.
      */
 
-    // The empty `tp_dict` gets populated by the previous dict.
-    PyObject *prop_dict = type->tp_dict;
-    if (PyDict_Update(prop_dict, prev_dict) < 0)
-        return false;
-
-    // We then replace methods by properties.
+    // We replace methods by properties. The methods are removed at the end
+    // since several properties may share them.
     bool lower = (id & 0x01) != 0;
     auto props = SbkObjectType_GetPropertyStrings(type);
     if (props == nullptr || *props == nullptr)
         return true;
+    AutoDecRef removed(PyList_New(0));
+    if (removed.isNull())
+        return false;
     for (; *props != nullptr; ++props) {
         auto propstr = *props;
         auto fields = parseFields(propstr);
@@ -611,26 +568,33 @@ static bool feature_02_true_property(PyTypeObject *type, PyObject *prev_dict, in
         PyObject *name = make_snake_case(fields[0], lower);
         PyObject *read = make_snake_case(fields[1], lower);
         PyObject *write = haveWrite ? make_snake_case(fields[2], lower) : nullptr;
-        PyObject *getter = PyDict_GetItem(prev_dict, read);
+        PyObject *getter = PyDict_GetItem(prop_dict, read);
         if (getter == nullptr || Py_TYPE(getter) != PepMethodDescr_TypePtr)
             continue;
-        PyObject *setter = haveWrite ? PyDict_GetItem(prev_dict, write) : nullptr;
+        PyObject *setter = haveWrite ? PyDict_GetItem(prop_dict, write) : nullptr;
         if (setter != nullptr && Py_TYPE(setter) != PepMethodDescr_TypePtr)
             continue;
 
         AutoDecRef PyProperty(createProperty(getter, setter));
         if (PyProperty.isNull())
             return false;
-        if (PyDict_SetItem(prop_dict, name, PyProperty) < 0)
+        if (fields[0] != fields[1] && PyList_Append(removed, read) < 0)
             return false;
-        if (fields[0] != fields[1] && PyDict_GetItem(prop_dict, read))
-            if (PyDict_DelItem(prop_dict, read) < 0)
-                return false;
         // Theoretically, we need to check for multiple signatures to be exact.
         // But we don't do so intentionally because it would be confusing.
-        if (haveWrite && PyDict_GetItem(prop_dict, write))
-            if (PyDict_DelItem(prop_dict, write) < 0)
-                return false;
+        if (haveWrite && PyList_Append(removed, write) < 0)
+            return false;
+        if (PyDict_SetItem(prop_dict, name, PyProperty) < 0)
+            return false;
+    }
+    for (Py_ssize_t idx = 0, size = PyList_Size(removed); idx < size; ++idx) {
+        PyObject *key = PyList_GetItem(removed, idx);
+        PyObject *value = PyDict_GetItem(prop_dict, key);
+        // A method name might have been replaced by a property.
+        if (value != nullptr && Py_TYPE(value) == PepMethodDescr_TypePtr
+            && PyDict_DelItem(prop_dict, key) < 0) {
+            return false;
+        }
     }
     return true;
 }
@@ -714,11 +678,8 @@ static bool patch_property_impl()
 //
 
 #define SIMILAR_FEATURE(xx)  \
-static bool feature_##xx##_addDummyNames(PyTypeObject *type, PyObject *prev_dict, int id) \
+static bool feature_##xx##_addDummyNames(PyTypeObject *type, PyObject *dict, int id) \
 { \
-    PyObject *dict = type->tp_dict; \
-    if (PyDict_Update(dict, prev_dict) < 0) \
-        return false; \
     if (PyDict_SetItemString(dict, "fake_feature_" #xx, Py_None) < 0) \
         return false; \
     return true; \
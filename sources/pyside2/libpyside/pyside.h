@@ -50,6 +50,7 @@
 
 #include <QtCore/QMetaType>
 #include <QtCore/QHash>
+#include <QtCore/QString>
 
 struct SbkObjectType;
 
@@ -154,6 +155,43 @@ PYSIDE_API void setQuickRegisterItemFunction(QuickRegisterItemFunction function)
  */
 PYSIDE_API QString pyStringToQString(PyObject *str);
 
+/**
+ * Converts UTF-16 data to a Python str using the narrowest character size
+ * possible. Returns a new reference or nullptr if an error occurs.
+ */
+PYSIDE_API PyObject *qStringToPyUnicode(const QChar *unicode, qsizetype size);
+
+/**
+ * Converts a QString to a Python str. When the string cache is enabled,
+ * repeated conversions of the same shared QString data return the same
+ * Python str. Returns a new reference or nullptr if an error occurs.
+ */
+PYSIDE_API PyObject *qStringToPyUnicode(const QString &str);
+
+struct QStringCacheStatistics
+{
+    qint64 hits = 0;
+    qint64 misses = 0;
+    qint64 evictions = 0;
+    int size = 0;
+    int capacity = 0;
+};
+
+/**
+ * Sets the maximum number of entries of the QString to Python str cache.
+ * A capacity of 0 disables and clears the cache, which is the default unless
+ * the environment variable PYSIDE_QSTRING_CACHE specifies a capacity.
+ * Python code can use PySide2.support.qstringcache.
+ */
+PYSIDE_API void setQStringCacheCapacity(int capacity);
+
+PYSIDE_API QStringCacheStatistics qStringCacheStatistics();
+
+/**
+ * Converts a Python str to a QString.
+ */
+PYSIDE_API QString pyUnicodeToQString(PyObject *str);
+
 /**
  * Registers a dynamic "qt.conf" file with the Qt resource system.
  *
@@ -50,10 +50,9 @@ PyObject *qtStaticMetaObject();
 PyObject *qtConnect();
 PyObject *qtDisconnect();
 PyObject *qtEmit();
-PyObject *dict_ring();
+PyObject *feature_dicts();
 PyObject *name();
 PyObject *property();
-PyObject *select_id();
 } // namespace PyName
 namespace PyMagicName
 {
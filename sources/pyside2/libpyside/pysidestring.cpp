@@ -0,0 +1,341 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of Qt for Python.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "pyside.h"
+
+#include <QtCore/QString>
+
+#include <cstring>
+#include <unordered_map>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  include <emmintrin.h>
+#  define PYSIDE_STRING_SSE2
+#endif
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Conversion between QString and Python str
+// -----------------------------------------
+//
+// Python strings (PEP 393) store their characters with 1, 2 or 4 bytes per
+// character, depending on the largest character. QString is UTF-16.
+// The conversions copy the characters directly between the representations,
+// so that strings of Latin-1 or UCS-2 characters are converted with a
+// single allocation and copy, without going through UTF-8 or wchar_t.
+//
+// The limited API has no access to the string data, there the conversions
+// go through the UTF-16 codec of Python and wchar_t.
+//
+
+namespace PySide
+{
+
+#if defined(IS_PY3K) && !defined(Py_LIMITED_API)
+
+// Returns the bitwise or of the UTF-16 code units. It is less than 0x80 for
+// ASCII strings and less than 0x100 for Latin-1 strings.
+static quint16 orCodeUnits(const quint16 *data, qsizetype size)
+{
+    qsizetype i = 0;
+    quint16 result = 0;
+#ifdef PYSIDE_STRING_SSE2
+    __m128i acc = _mm_setzero_si128();
+    for (; i + 8 <= size; i += 8)
+        acc = _mm_or_si128(acc, _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i)));
+    acc = _mm_or_si128(acc, _mm_srli_si128(acc, 8));
+    acc = _mm_or_si128(acc, _mm_srli_si128(acc, 4));
+    acc = _mm_or_si128(acc, _mm_srli_si128(acc, 2));
+    result = quint16(_mm_cvtsi128_si32(acc));
+#endif
+    for (; i < size; ++i)
+        result |= data[i];
+    return result;
+}
+
+static bool hasSurrogates(const quint16 *data, qsizetype size)
+{
+    qsizetype i = 0;
+#ifdef PYSIDE_STRING_SSE2
+    const __m128i mask = _mm_set1_epi16(short(0xF800));
+    const __m128i surrogate = _mm_set1_epi16(short(0xD800));
+    for (; i + 8 <= size; i += 8) {
+        const __m128i units = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(units, mask), surrogate)) != 0)
+            return true;
+    }
+#endif
+    for (; i < size; ++i) {
+        if ((data[i] & 0xF800) == 0xD800)
+            return true;
+    }
+    return false;
+}
+
+// Copies UTF-16 code units less than 0x100 into Latin-1 characters.
+static void narrow(const quint16 *data, qsizetype size, Py_UCS1 *out)
+{
+    qsizetype i = 0;
+#ifdef PYSIDE_STRING_SSE2
+    for (; i + 16 <= size; i += 16) {
+        const __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i));
+        const __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + i + 8));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i), _mm_packus_epi16(low, high));
+    }
+#endif
+    for (; i < size; ++i)
+        out[i] = Py_UCS1(data[i]);
+}
+
+PyObject *qStringToPyUnicode(const QChar *unicode, qsizetype size)
+{
+    const auto *data = reinterpret_cast<const quint16 *>(unicode);
+    const quint16 bits = orCodeUnits(data, size);
+    if (bits < 0x100) {
+        PyObject *result = PyUnicode_New(size, bits < 0x80 ? 0x7F : 0xFF);
+        if (result != nullptr)
+            narrow(data, size, PyUnicode_1BYTE_DATA(result));
+        return result;
+    }
+    // Surrogates are 0xD800 - 0xDFFF, so they can only occur when that is set.
+    if (bits < 0xD800 || !hasSurrogates(data, size)) {
+        PyObject *result = PyUnicode_New(size, 0xFFFF);
+        if (result != nullptr)
+            std::memcpy(PyUnicode_2BYTE_DATA(result), data, size_t(size) * sizeof(quint16));
+        return result;
+    }
+    // The surrogate pairs need to be combined into UCS-4 characters.
+    int byteOrder = Q_BYTE_ORDER == Q_LITTLE_ENDIAN ? -1 : 1;
+    return PyUnicode_DecodeUTF16(reinterpret_cast<const char *>(data),
+                                 Py_ssize_t(size) * 2, "replace", &byteOrder);
+}
+
+QString pyUnicodeToQString(PyObject *str)
+{
+    if (PyUnicode_READY(str) < 0)
+        return QString();
+    const Py_ssize_t size = PyUnicode_GET_LENGTH(str);
+    const void *data = PyUnicode_DATA(str);
+    switch (PyUnicode_KIND(str)) {
+    case PyUnicode_1BYTE_KIND:
+        return QString::fromLatin1(static_cast<const char *>(data), size);
+    case PyUnicode_2BYTE_KIND:
+        return QString(static_cast<const QChar *>(data), size);
+    default:
+        break;
+    }
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+    return QString::fromUcs4(static_cast<const char32_t *>(data), size);
+#else
+    return QString::fromUcs4(static_cast<const uint *>(data), size);
+#endif
+}
+
+#elif defined(IS_PY3K) // Py_LIMITED_API
+
+PyObject *qStringToPyUnicode(const QChar *unicode, qsizetype size)
+{
+    int byteOrder = Q_BYTE_ORDER == Q_LITTLE_ENDIAN ? -1 : 1;
+    return PyUnicode_DecodeUTF16(reinterpret_cast<const char *>(unicode),
+                                 Py_ssize_t(size) * 2, "replace", &byteOrder);
+}
+
+QString pyUnicodeToQString(PyObject *str)
+{
+    wchar_t *temp = PyUnicode_AsWideCharString(str, nullptr);
+    const QString result = QString::fromWCharArray(temp);
+    PyMem_Free(temp);
+    return result;
+}
+
+#else // IS_PY3K
+
+PyObject *qStringToPyUnicode(const QChar *unicode, qsizetype size)
+{
+    const QByteArray ba = QString::fromRawData(unicode, size).toUtf8();
+    return PyUnicode_FromStringAndSize(ba.constData(), ba.size());
+}
+
+QString pyUnicodeToQString(PyObject *str)
+{
+    Py_UNICODE *unicode = PyUnicode_AS_UNICODE(str);
+#  if defined(Py_UNICODE_WIDE)
+    return QString::fromUcs4(reinterpret_cast<const uint *>(unicode));
+#  else
+    return QString::fromUtf16(reinterpret_cast<const ushort *>(unicode), PepUnicode_GetLength(str));
+#  endif
+}
+
+#endif // IS_PY3K
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// QString to Python str cache
+// ---------------------------
+//
+// Object names, property names or model data are often converted repeatedly
+// from the same implicitly shared QString. The opt-in cache maps the address
+// of the shared character data to the Python str created for it.
+//
+// An entry keeps a copy of the QString, so that the data cannot be freed and
+// reused for a different string while the entry exists. Only strings that
+// are shared at the time of the conversion are cached; temporaries would be
+// dropped right afterwards. An entry becomes stale when its copy holds the
+// last reference to the data. Stale entries are swept when the cache is
+// full; if that does not make room, the cache is cleared.
+//
+
+namespace {
+
+struct QStringCacheEntry
+{
+    QString string;
+    PyObject *pyString;
+};
+
+struct QStringCache
+{
+    QStringCache()
+    {
+        statistics.capacity = qMax(0, qEnvironmentVariableIntValue("PYSIDE_QSTRING_CACHE"));
+    }
+
+    std::unordered_map<const QChar *, QStringCacheEntry> entries;
+    QStringCacheStatistics statistics;
+    bool cleanupRegistered = false;
+};
+
+} // namespace
+
+static QStringCache &qStringCache()
+{
+    static QStringCache cache;
+    return cache;
+}
+
+static void clearQStringCache()
+{
+    QStringCache &cache = qStringCache();
+    for (auto &it : cache.entries)
+        Py_DECREF(it.second.pyString);
+    cache.statistics.evictions += qint64(cache.entries.size());
+    cache.entries.clear();
+}
+
+static void sweepQStringCache()
+{
+    QStringCache &cache = qStringCache();
+    auto &entries = cache.entries;
+    for (auto it = entries.begin(); it != entries.end(); ) {
+        if (it->second.string.isDetached()) {
+            Py_DECREF(it->second.pyString);
+            it = entries.erase(it);
+            ++cache.statistics.evictions;
+        } else {
+            ++it;
+        }
+    }
+    if (entries.size() >= size_t(cache.statistics.capacity))
+        clearQStringCache();
+}
+
+// Literals and raw data are not owned by the QString.
+static bool ownsData(QString &str)
+{
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+    return str.data_ptr().isMutable();
+#else
+    return str.data_ptr()->isMutable();
+#endif
+}
+
+PyObject *qStringToPyUnicode(const QString &str)
+{
+    QStringCache &cache = qStringCache();
+    if (cache.statistics.capacity == 0 || str.isDetached())
+        return qStringToPyUnicode(str.unicode(), str.size());
+
+    QString copy = str;
+    if (!ownsData(copy))
+        return qStringToPyUnicode(str.unicode(), str.size());
+
+    auto it = cache.entries.find(copy.unicode());
+    if (it != cache.entries.end() && it->second.string.size() == copy.size()) {
+        ++cache.statistics.hits;
+        Py_INCREF(it->second.pyString);
+        return it->second.pyString;
+    }
+
+    ++cache.statistics.misses;
+    PyObject *result = qStringToPyUnicode(copy.unicode(), copy.size());
+    if (result == nullptr)
+        return nullptr;
+    if (it != cache.entries.end()) {
+        Py_DECREF(it->second.pyString);
+        cache.entries.erase(it);
+        ++cache.statistics.evictions;
+    }
+    if (cache.entries.size() >= size_t(cache.statistics.capacity))
+        sweepQStringCache();
+    if (!cache.cleanupRegistered) {
+        registerCleanupFunction(clearQStringCache);
+        cache.cleanupRegistered = true;
+    }
+    const QChar *key = copy.unicode();
+    Py_INCREF(result);
+    cache.entries.emplace(key, QStringCacheEntry{std::move(copy), result});
+    return result;
+}
+
+void setQStringCacheCapacity(int capacity)
+{
+    QStringCache &cache = qStringCache();
+    cache.statistics.capacity = qMax(0, capacity);
+    if (cache.entries.size() > size_t(cache.statistics.capacity))
+        clearQStringCache();
+}
+
+QStringCacheStatistics qStringCacheStatistics()
+{
+    QStringCacheStatistics result = qStringCache().statistics;
+    result.size = int(qStringCache().entries.size());
+    return result;
+}
+
+} // namespace PySide
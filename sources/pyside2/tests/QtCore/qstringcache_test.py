@@ -0,0 +1,111 @@
+#!/usr/bin/python
+# -*- coding: utf-8 -*-
+
+#############################################################################
+##
+## Copyright (C) 2020 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+'''Test cases for the opt-in QString to Python str cache'''
+
+import os
+import sys
+import unittest
+
+# The capacity is read when the first string is converted.
+os.environ['PYSIDE_QSTRING_CACHE'] = '16'
+
+sys.path.append(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+from init_paths import init_test_paths
+init_test_paths(False)
+
+from PySide2.QtCore import QObject
+from PySide2.support import qstringcache
+
+
+class QStringCacheTest(unittest.TestCase):
+
+    def tearDown(self):
+        qstringcache.set_capacity(16)
+
+    def testSharedStringIsReused(self):
+        obj = QObject()
+        obj.setObjectName('cached object name ' * 4)
+        first = obj.objectName()
+        self.assertIs(obj.objectName(), first)
+
+    def testChangedStringIsNotReused(self):
+        obj = QObject()
+        obj.setObjectName('first object name ' * 4)
+        first = obj.objectName()
+        obj.setObjectName('second object name ' * 4)
+        second = obj.objectName()
+        self.assertEqual(first, 'first object name ' * 4)
+        self.assertEqual(second, 'second object name ' * 4)
+
+    def testEviction(self):
+        objects = [QObject() for i in range(64)]
+        for i, obj in enumerate(objects):
+            obj.setObjectName('object {}'.format(i))
+        for i, obj in enumerate(objects):
+            self.assertEqual(obj.objectName(), 'object {}'.format(i))
+
+    def testEvictionAtCapacity(self):
+        qstringcache.set_capacity(0)
+        self.assertEqual(qstringcache.statistics()['size'], 0)
+        qstringcache.set_capacity(4)
+        objects = [QObject() for i in range(5)]
+        for i, obj in enumerate(objects):
+            obj.setObjectName('evicted object name {}'.format(i))
+        for obj in objects[:4]:
+            obj.objectName()
+        before = qstringcache.statistics()
+        self.assertEqual(before['size'], 4)
+        self.assertEqual(before['capacity'], 4)
+
+        # All cached strings are still used by their objects, so the cache
+        # is cleared to make room.
+        name = objects[4].objectName()
+        stats = qstringcache.statistics()
+        self.assertEqual(stats['evictions'] - before['evictions'], 4)
+        self.assertEqual(stats['size'], 1)
+        self.assertIs(objects[4].objectName(), name)
+        self.assertEqual(qstringcache.statistics()['hits'], stats['hits'] + 1)
+
+        # A string no longer used by its object is swept instead.
+        for obj in objects[:3]:
+            obj.objectName()
+        del objects[0]
+        before = qstringcache.statistics()
+        self.assertEqual(before['size'], 4)
+        objects[2].objectName()
+        stats = qstringcache.statistics()
+        self.assertEqual(stats['evictions'] - before['evictions'], 1)
+        self.assertEqual(stats['size'], 4)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,81 @@
+#!/usr/bin/python
+# -*- coding: utf-8 -*-
+
+#############################################################################
+##
+## Copyright (C) 2020 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+
+'''Test cases for the conversion of Python objects to and from QVariant'''
+
+import os
+import sys
+import unittest
+
+sys.path.append(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+from init_paths import init_test_paths
+init_test_paths(False)
+
+from PySide2.QtCore import QObject, QSize, QTimer
+
+
+class DerivedObject(QObject):
+    pass
+
+
+class QVariantConversionTest(unittest.TestCase):
+
+    def roundTrip(self, value):
+        obj = QObject()
+        obj.setProperty('value', value)
+        return obj.property('value')
+
+    def testBuiltinTypes(self):
+        for value in (True, False, 42, -7, 2**40, -2**40, 1.5, 'text'):
+            result = self.roundTrip(value)
+            self.assertEqual(result, value)
+            self.assertEqual(type(result), type(value))
+        self.assertEqual(self.roundTrip(None), None)
+
+    def testLists(self):
+        self.assertEqual(self.roundTrip(['a', 'b']), ['a', 'b'])
+        self.assertEqual(self.roundTrip([]), [])
+        self.assertEqual(self.roundTrip([1, 'a', 2.5, None]), [1, 'a', 2.5, None])
+
+    def testDict(self):
+        self.assertEqual(self.roundTrip({'a': 1, 'b': [True]}), {'a': 1, 'b': [True]})
+
+    def testWrapperTypes(self):
+        self.assertEqual(self.roundTrip(QSize(1, 2)), QSize(1, 2))
+        timer = QTimer()
+        self.assertIs(self.roundTrip(timer), timer)
+        # Repeated conversions use the cached metatype of the type.
+        self.assertIs(self.roundTrip(timer), timer)
+        derived = DerivedObject()
+        self.assertIs(self.roundTrip(derived), derived)
+
+
+if __name__ == '__main__':
+    unittest.main()
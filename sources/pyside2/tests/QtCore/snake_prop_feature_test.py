@@ -37,9 +37,11 @@
 ##
 #############################################################################
 
+import gc
 import os
 import sys
 import unittest
+import weakref
 
 sys.path.append(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
 from init_paths import init_test_paths
@@ -101,6 +103,22 @@ class FeatureTest(unittest.TestCase):
         with self.assertRaises(AttributeError):
             window.modal
 
+    def testSubclassIsCollected(self):
+        class Temporary(Window):
+            pass
+
+        window = Temporary()
+        from __feature__ import snake_case, true_property
+        # Creates the feature dicts of `Temporary`.
+        self.assertTrue(isinstance(window.modal, bool))
+        __feature__.set_selection(0)
+        self.assertTrue(callable(window.isModal))
+
+        ref = weakref.ref(Temporary)
+        del window, Temporary
+        gc.collect()
+        self.assertIsNone(ref())
+
 
 if __name__ == '__main__':
     unittest.main()
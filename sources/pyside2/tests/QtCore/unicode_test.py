@@ -65,6 +65,18 @@ class UnicodeConversion(unittest.TestCase):
         obj.setObjectName(py3k.unicode_('ümlaut'))
         self.assertEqual(obj.objectName(), py3k.unicode_('ümlaut'))
 
+    def testRoundTripCharacterSizes(self):
+        # Strings of each character size (ASCII, Latin-1, UCS-2 and
+        # characters outside the BMP needing surrogate pairs), short and long.
+        obj = QObject()
+        for text in (u'', u'a', u'ascii', u'ümlaut', u'\u20ac uro', u'\U0001f632 emoji',
+                     u'x\U0001f632y\u20acz\xe9'):
+            for value in (text, text * 37):
+                obj.setObjectName(value)
+                result = obj.objectName()
+                self.assertEqual(result, value)
+                self.assertEqual(len(result), len(value))
+
 if __name__ == '__main__':
     unittest.main()
 
@@ -26,6 +26,7 @@
 ##
 #############################################################################
 
+import array
 import os
 import sys
 import unittest
@@ -92,6 +93,13 @@ class QMatrixTest(unittest.TestCase):
         d = m.copyDataTo()
         self.assertTrue(my_data == list(d))
 
+    @unittest.skipUnless(sys.version_info[0] >= 3, "requires the new buffer protocol")
+    def testMatrix4x4FromBuffer(self):
+        my_data = array.array('f', range(16))
+        m = QMatrix4x4(my_data)
+        self.assertEqual(list(m.copyDataTo()), list(my_data))
+        self.assertEqual(m, QMatrix4x4(list(my_data)))
+
     def testMatrixMapping(self):
         m = QMatrix(1.0, 2.0, 1.0, 3.0, 100.0, 200.0)
         res = m.map(5, 5)
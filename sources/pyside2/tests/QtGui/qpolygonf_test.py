@@ -26,6 +26,7 @@
 ##
 #############################################################################
 
+import array
 import os
 import sys
 import unittest
@@ -37,6 +38,12 @@ init_test_paths(False)
 from PySide2.QtCore import QPoint, QPointF
 from PySide2.QtGui import QPolygon, QPolygonF
 
+try:
+    import numpy as np
+    have_numpy = True
+except ImportError:
+    have_numpy = False
+
 
 class QPolygonFNotIterableTest(unittest.TestCase):
     """Test if a QPolygonF is iterable"""
@@ -61,6 +68,23 @@ class QPolygonFNotIterableTest(unittest.TestCase):
         p << QPoint(10, 20) << QPoint(20, 30) << [QPoint(20, 30), QPoint(40, 50)]
         self.assertEqual(len(p), 4)
 
+    def testFromBuffer(self):
+        p = QPolygonF(array.array('d', [1.0, 2.0, 3.0, 4.0]))
+        self.assertEqual(list(p), [QPointF(1.0, 2.0), QPointF(3.0, 4.0)])
+        p = QPolygon(array.array('i', [1, 2, 3, 4, 5, 6]))
+        self.assertEqual(list(p), [QPoint(1, 2), QPoint(3, 4), QPoint(5, 6)])
+
+    @unittest.skipUnless(have_numpy, "requires numpy")
+    def testArrayInterface(self):
+        p = QPolygonF(np.array([[1.0, 2.0], [3.0, 4.0]]))
+        self.assertEqual(list(p), [QPointF(1.0, 2.0), QPointF(3.0, 4.0)])
+        points = np.asarray(p)
+        self.assertEqual(points.shape, (2, 2))
+        self.assertEqual(points[1, 0], 3.0)
+        # The array shares the points of the polygon
+        points[0, 1] = 5.0
+        self.assertEqual(p[0], QPointF(1.0, 5.0))
+
 
 if __name__ == '__main__':
     unittest.main()
@@ -42,6 +42,12 @@ from PySide2.QtWidgets import *
 from helper.helper import adjust_filename
 from helper.usesqapplication import UsesQApplication
 
+try:
+    import numpy as np
+    have_numpy = True
+except ImportError:
+    have_numpy = False
+
 xpm = [
     "27 22 206 2",
     "   c None",
@@ -304,6 +310,60 @@ class QImageTest(UsesQApplication):
     def testEmptyStringAsBuffer(self):
         img = QImage(py3k.b(''), 100, 100, QImage.Format_ARGB32)
 
+    def testBufferIsKeptAlive(self):
+        data = bytearray(b'\x10\x20\x30\x40' * 4)
+        img = QImage(data, 2, 2, QImage.Format_ARGB32)
+        refCount = sys.getrefcount(data)
+        copy = QImage(img)
+        del img
+        self.assertEqual(sys.getrefcount(data), refCount)
+        del copy
+        self.assertEqual(sys.getrefcount(data), refCount - 1)
+
+    @unittest.skipUnless(py3k.IS_PY3K, "requires the new buffer protocol")
+    def testBufferStaysExported(self):
+        data = bytearray(b'\x10\x20\x30\x40' * 4)
+        img = QImage(data, 2, 2, QImage.Format_ARGB32)
+        # The image uses the memory, it must not be reallocated
+        self.assertRaises(BufferError, data.extend, b'\x00')
+        del img
+        data.extend(b'\x00')
+
+    @unittest.skipUnless(py3k.IS_PY3K, "requires the new buffer protocol")
+    def testBitsKeepImageAlive(self):
+        img = QImage(2, 2, QImage.Format_ARGB32)
+        img.fill(QColor(1, 2, 3, 4))
+        bits = img.bits()
+        line = img.constScanLine(1)
+        self.assertIs(bits.obj, img)
+        self.assertTrue(line.readonly)
+        del img
+        self.assertEqual(bytes(line), bytes(bits[8:16]))
+
+    @unittest.skipUnless(have_numpy, "requires numpy")
+    def testArrayInterface(self):
+        img = QImage(3, 2, QImage.Format_RGBA8888)
+        img.fill(QColor(1, 2, 3, 4))
+        array = np.asarray(img)
+        self.assertEqual(array.shape, (2, 3, 4))
+        self.assertEqual(array.dtype, np.uint8)
+        self.assertEqual(list(array[1, 2]), [1, 2, 3, 4])
+        array[0, 0] = [5, 6, 7, 8]
+        self.assertEqual(img.pixelColor(0, 0), QColor(5, 6, 7, 8))
+        # The array keeps the image alive
+        del img
+        self.assertEqual(list(array[0, 0]), [5, 6, 7, 8])
+
+    @unittest.skipUnless(have_numpy, "requires numpy")
+    def testArrayConstructor(self):
+        array = np.zeros((2, 3, 4), dtype=np.uint8)
+        array[1, 2] = [1, 2, 3, 4]
+        img = QImage(array, 3, 2, QImage.Format_RGBA8888)
+        self.assertEqual(img.pixelColor(2, 1), QColor(1, 2, 3, 4))
+        # The image uses the array memory without copying
+        array[0, 0] = [5, 6, 7, 8]
+        self.assertEqual(img.pixelColor(0, 0), QColor(5, 6, 7, 8))
+
     def testXpmConstructor(self):
         label = QLabel()
         img = QImage(xpm)
@@ -0,0 +1,70 @@
+#############################################################################
+##
+## Copyright (C) 2020 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of PySide2.
+##
+## $QT_BEGIN_LICENSE:LGPL$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU Lesser General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU Lesser
+## General Public License version 3 as published by the Free Software
+## Foundation and appearing in the file LICENSE.LGPL3 included in the
+## packaging of this file. Please review the following information to
+## ensure the GNU Lesser General Public License version 3 requirements
+## will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 2.0 or (at your option) the GNU General
+## Public license version 3 or any later version approved by the KDE Free
+## Qt Foundation. The licenses are as published by the Free Software
+## Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-2.0.html and
+## https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+
+import os
+import sys
+import unittest
+
+sys.path.append(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+from init_paths import init_test_paths
+init_test_paths(False)
+
+# This test tests the deferred loading of the signature module.
+# By setting the variable "pyside_lazy_signature", the signature
+# package is loaded on first use instead of during the import.
+
+
+class LazySignatureTest(unittest.TestCase):
+
+    # As in embedding_test.py, there is no way to trigger a second
+    # initialization, so everything is checked in one test.
+    def test_lazy_signature(self):
+        import sys
+        sys.pyside_lazy_signature = True
+        from PySide2 import QtCore
+        self.assertFalse("PySide2.support.signature" in sys.modules)
+        self.assertFalse("shibokensupport.signature.parser" in sys.modules)
+        # The first signature request loads everything.
+        sig = QtCore.QObject.setObjectName.__signature__
+        self.assertTrue("PySide2.support.signature" in sys.modules)
+        self.assertEqual(list(sig.parameters), ["self", "name"])
+
+if __name__ == '__main__':
+    unittest.main()
@@ -40,6 +40,7 @@
 
 #include <QDebug>
 #include <QDir>
+#include <QElapsedTimer>
 #include <QFile>
 #include <QFileInfo>
 #include <QRegularExpression>
@@ -692,12 +693,22 @@ bool AbstractMetaBuilder::build(const QByteArrayList &arguments,
                                 LanguageLevel level,
                                 unsigned clangFlags)
 {
+    QElapsedTimer timer;
+    timer.start();
     const FileModelItem dom = d->buildDom(arguments, level, clangFlags);
     if (dom.isNull())
         return false;
+    const qint64 parseTime = timer.restart();
     if (ReportHandler::isDebug(ReportHandler::MediumDebug))
         qCDebug(lcShiboken) << dom.data();
     d->traverseDom(dom);
+    const qint64 traverseTime = timer.elapsed();
+    if (ReportHandler::isDebug(ReportHandler::SparseDebug)) {
+        qCInfo(lcShiboken).noquote().nospace()
+            << "Parsing: " << parseTime << "ms, traversing: " << traverseTime
+            << "ms (type translation cache: " << d->m_translateTypeCacheHits
+            << " hits, " << d->m_translateTypeCacheMisses << " misses)";
+    }
 
     // Ensure that indexes are in alphabetical order, roughly
     std::sort(d->m_globalEnums.begin(), d->m_globalEnums.end(), metaEnumLessThan);
@@ -721,6 +732,7 @@ void AbstractMetaBuilderPrivate::addAbstractMetaClass(AbstractMetaClass *cls,
 {
     cls->setOriginalAttributes(cls->attributes());
     m_itemToClass.insert(item, cls);
+    clearTranslateTypeCache();
     if (cls->typeEntry()->isContainer()) {
         m_templates << cls;
     } else if (cls->typeEntry()->isSmartPointer()) {
@@ -830,6 +842,7 @@ AbstractMetaEnum *AbstractMetaBuilderPrivate::traverseEnum(const EnumModelItem &
         typeEntry = new EnumTypeEntry(enumItem->qualifiedName().constLast(),
                                       QVersionNumber(0, 0), enclosingTypeEntry);
         TypeDatabase::instance()->addType(typeEntry);
+        clearTranslateTypeCache();
     } else if (enumItem->enumKind() != AnonymousEnum) {
         typeEntry = TypeDatabase::instance()->findType(qualifiedName);
     } else {
@@ -933,6 +946,8 @@ AbstractMetaEnum *AbstractMetaBuilderPrivate::traverseEnum(const EnumModelItem &
         if (e->value().isNullValue())
             enumTypeEntry->setNullValue(enumValue);
     }
+    if (!enumerators.isEmpty())
+        clearTranslateTypeCache();
 
     return metaEnum;
 }
@@ -1011,6 +1026,7 @@ void AbstractMetaBuilderPrivate::traverseTypesystemTypedefs()
             sourceType->setInstantiations(metaClass->templateBaseClassInstantiations());
             sourceType->decideUsagePattern();
             m_typeSystemTypeDefs.append({AbstractMetaTypeCPtr(sourceType), metaClass});
+            clearTranslateTypeCache();
         }
     }
 }
@@ -2130,12 +2146,61 @@ const AbstractMetaClass *AbstractMetaBuilderPrivate::resolveTypeSystemTypeDef(co
     return nullptr;
 }
 
+void AbstractMetaBuilderPrivate::clearTranslateTypeCache()
+{
+    m_translateTypeCache.clear();
+}
+
+// Deep copy of a cached type, cloning the instantiations which are otherwise
+// shared by AbstractMetaType::copy(), also those of the array element type.
+static AbstractMetaType *cloneCachedType(const AbstractMetaType *t)
+{
+    AbstractMetaType *result = t->copy();
+    const AbstractMetaTypeList &instantiations = t->instantiations();
+    if (!instantiations.isEmpty()) {
+        AbstractMetaTypeList clonedInstantiations;
+        clonedInstantiations.reserve(instantiations.size());
+        for (const AbstractMetaType *i : instantiations)
+            clonedInstantiations.append(cloneCachedType(i));
+        result->setInstantiations(clonedInstantiations, true);
+    }
+    if (const AbstractMetaType *elementType = t->arrayElementType()) {
+        delete result->arrayElementType(); // shallow copy made by copy()
+        result->setArrayElementType(cloneCachedType(elementType));
+    }
+    return result;
+}
+
 AbstractMetaType *AbstractMetaBuilderPrivate::translateType(const TypeInfo &_typei,
                                                             AbstractMetaClass *currentClass,
                                                             TranslateTypeFlags flags,
                                                             QString *errorMessage)
 {
-    return translateTypeStatic(_typei, currentClass, this, flags, errorMessage);
+    // The result depends on the class context (name lookup, template
+    // parameters) and on the namespace scope (typedef resolution).
+    QString key = _typei.toString();
+    key += QLatin1Char('|');
+    key += QString::number(int(flags));
+    key += QLatin1Char('|');
+    if (currentClass)
+        key += currentClass->qualifiedCppName();
+    if (!m_scopes.isEmpty()) {
+        key += QLatin1Char('|');
+        key += m_scopes.constLast()->qualifiedName().join(colonColon());
+    }
+
+    const auto it = m_translateTypeCache.constFind(key);
+    if (it != m_translateTypeCache.cend()) {
+        ++m_translateTypeCacheHits;
+        return cloneCachedType(it.value().data());
+    }
+
+    ++m_translateTypeCacheMisses;
+    AbstractMetaType *result = translateTypeStatic(_typei, currentClass, this, flags, errorMessage);
+    // Failures are not cached since the type might be added later on.
+    if (result)
+        m_translateTypeCache.insert(key, AbstractMetaTypeCPtr(cloneCachedType(result)));
+    return result;
 }
 
 static bool isNumber(const QString &s)
@@ -2300,6 +2365,8 @@ AbstractMetaType *AbstractMetaBuilderPrivate::translateTypeStatic(const TypeInfo
             const QString value = ti.qualifiedName().join(colonColon());
             if (isNumber(value)) {
                 TypeDatabase::instance()->addConstantValueTypeEntry(value, type->typeSystemTypeEntry());
+                if (d)
+                    d->clearTranslateTypeCache();
                 targType = translateTypeStatic(ti, currentClass, d, flags, &errorMessage);
             }
         }
@@ -2680,6 +2747,7 @@ bool AbstractMetaBuilderPrivate::inheritTemplate(AbstractMetaClass *subclass,
             if (!t) {
                 auto parent = subclass->typeEntry()->typeSystemTypeEntry();
                 t = TypeDatabase::instance()->addConstantValueTypeEntry(typeName, parent);
+                clearTranslateTypeCache();
             }
         } else {
             QStringList possibleNames;
@@ -153,6 +153,7 @@ public:
                                                  AbstractMetaBuilderPrivate *d = nullptr,
                                                  TranslateTypeFlags flags = {},
                                                  QString *errorMessageIn = nullptr);
+    void clearTranslateTypeCache();
     static TypeEntries findTypeEntries(const QString &qualifiedName, const QString &name,
                                        AbstractMetaClass *currentClass = nullptr,
                                        AbstractMetaBuilderPrivate *d = nullptr);
@@ -210,6 +211,13 @@ public:
     mutable QHash<QString, Include> m_resolveIncludeHash;
     QVector<TypeClassEntry> m_typeSystemTypeDefs; // look up metatype->class for type system typedefs
     bool m_skipDeprecated = false;
+
+    // Memoized results of translateType() keyed by the normalized type
+    // spelling and the scope. Entries are cloned on use and the cache is
+    // cleared whenever type entries or classes are added.
+    QHash<QString, AbstractMetaTypeCPtr> m_translateTypeCache;
+    int m_translateTypeCacheHits = 0;
+    int m_translateTypeCacheMisses = 0;
 };
 
 #endif // ABSTRACTMETBUILDER_P_H
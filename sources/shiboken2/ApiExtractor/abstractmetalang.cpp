@@ -1928,6 +1928,21 @@ bool AbstractMetaClass::hasPrivateCopyConstructor() const
     return copyCt && copyCt->isPrivate();
 }
 
+const AbstractMetaFunction *AbstractMetaClass::moveConstructor() const
+{
+    for (const AbstractMetaFunction *f : m_functions) {
+        if (f->functionType() == AbstractMetaFunction::MoveConstructorFunction)
+            return f;
+    }
+    return nullptr;
+}
+
+bool AbstractMetaClass::hasPublicMoveConstructor() const
+{
+    const AbstractMetaFunction *moveCt = moveConstructor();
+    return moveCt && moveCt->isPublic();
+}
+
 void AbstractMetaClass::addDefaultConstructor()
 {
     auto *f = new AbstractMetaFunction;
@@ -1322,6 +1322,8 @@ public:
     const AbstractMetaFunction *copyConstructor() const;
     bool hasCopyConstructor() const { return copyConstructor() != nullptr; }
     bool hasPrivateCopyConstructor() const;
+    const AbstractMetaFunction *moveConstructor() const;
+    bool hasPublicMoveConstructor() const;
 
     void addDefaultConstructor();
     void addDefaultCopyConstructor(bool isPrivate = false);
@@ -31,6 +31,7 @@
 
 #include <QDir>
 #include <QDebug>
+#include <QElapsedTimer>
 #include <QTemporaryFile>
 #include <algorithm>
 #include <iostream>
@@ -190,10 +191,16 @@ bool ApiExtractor::run(bool usePySideExtensions)
     if (m_builder)
         return false;
 
+    QElapsedTimer timer;
+    timer.start();
     if (!TypeDatabase::instance()->parseFile(m_typeSystemFileName)) {
         std::cerr << "Cannot parse file: " << qPrintable(m_typeSystemFileName);
         return false;
     }
+    if (ReportHandler::isDebug(ReportHandler::SparseDebug)) {
+        qCInfo(lcShiboken).noquote().nospace()
+            << "Parsing type system: " << timer.elapsed() << "ms";
+    }
 
     const QString pattern = QDir::tempPath() + QLatin1Char('/')
         + m_cppFileNames.constFirst().baseName()
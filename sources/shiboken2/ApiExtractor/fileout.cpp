@@ -36,6 +36,7 @@
 #include <QtCore/QFileInfo>
 #include <QtCore/QDir>
 #include <QtCore/QDebug>
+#include <QtCore/QHash>
 
 #include <cstdio>
 
@@ -67,24 +68,11 @@ FileOut::~FileOut()
         done();
 }
 
-static QVector<int> lcsLength(const QByteArrayList &a, const QByteArrayList &b)
-{
-    const int height = a.size() + 1;
-    const int width = b.size() + 1;
-
-    QVector<int> res(width * height, 0);
-
-    for (int row = 1; row < height; row++) {
-        for (int col = 1; col < width; col++) {
-            if (a[row-1] == b[col-1])
-                res[width * row + col] = res[width * (row-1) + col-1] + 1;
-            else
-                res[width * row + col] = qMax(res[width * row     + col-1],
-                                              res[width * (row-1) + col]);
-        }
-    }
-    return res;
-}
+// Line based diff using the linear space variant of the algorithm described
+// in E. Myers, "An O(ND) Difference Algorithm and Its Variations" (1986).
+// The middle snake of the edit graph is found by searching from both ends
+// simultaneously, which only requires two diagonal vectors of size O(N+M)
+// instead of a (N+1)*(M+1) LCS table.
 
 enum Type {
     Add,
@@ -95,82 +83,284 @@ enum Type {
 struct Unit
 {
     Type type;
-    int start;
+    int start; // Half-open range in "a" (Delete, Unchanged) or "b" (Add)
     int end;
+};
+
+using Units = QVector<Unit>;
+
+struct Snake
+{
+    int x;
+    int y;
+    int u;
+    int v;
+    int d; // Length of the shortest edit script
+};
+
+class LineDiff
+{
+public:
+    LineDiff(const QByteArrayList &a, const QByteArrayList &b);
+
+    Units run();
 
-    void print(const QByteArrayList &a, const QByteArrayList &b) const;
+private:
+    void compare(int aBegin, int aEnd, int bBegin, int bEnd);
+    Snake middleSnake(int aBegin, int aEnd, int bBegin, int bEnd);
+    void append(Type type, int start, int end);
+
+    QVector<int> m_a; // Lines mapped to integer ids for fast comparison
+    QVector<int> m_b;
+    QVector<int> m_forward;
+    QVector<int> m_backward;
+    Units m_units;
 };
 
-void Unit::print(const QByteArrayList &a, const QByteArrayList &b) const
-{
-    switch (type) {
-    case Unchanged:
-        if ((end - start) > 9) {
-            for (int i = start; i <= start + 2; i++)
-                std::printf("  %s\n", a.at(i).constData());
-            std::printf("%s=\n= %d more lines\n=%s\n",
-                        colorInfo, end - start - 6, colorReset);
-            for (int i = end - 2; i <= end; i++)
-                std::printf("  %s\n", a.at(i).constData());
-        } else {
-            for (int i = start; i <= end; i++)
-                std::printf("  %s\n", a.at(i).constData());
+LineDiff::LineDiff(const QByteArrayList &a, const QByteArrayList &b)
+{
+    QHash<QByteArray, int> ids;
+    auto mapLines = [&ids](const QByteArrayList &lines, QVector<int> *result) {
+        result->reserve(lines.size());
+        for (const QByteArray &line : lines) {
+            auto it = ids.constFind(line);
+            if (it == ids.cend())
+                it = ids.insert(line, ids.size());
+            result->append(it.value());
         }
-        break;
-    case Add:
-        std::fputs(colorAdd, stdout);
-        for (int i = start; i <= end; i++)
-            std::printf("+ %s\n", b.at(i).constData());
-        std::fputs(colorReset, stdout);
-        break;
-    case Delete:
-        std::fputs(colorDelete, stdout);
-        for (int i = start; i <= end; i++)
-            std::printf("- %s\n", a.at(i).constData());
-        std::fputs(colorReset, stdout);
-        break;
-    }
+    };
+    mapLines(a, &m_a);
+    mapLines(b, &m_b);
+    const int size = 2 * (m_a.size() + m_b.size()) + 3;
+    m_forward.resize(size);
+    m_backward.resize(size);
 }
 
-static void unitAppend(Type type, int pos, QVector<Unit> *units)
+Units LineDiff::run()
 {
-    if (!units->isEmpty() && units->last().type == type)
-        units->last().end = pos;
+    m_units.clear();
+    compare(0, m_a.size(), 0, m_b.size());
+    return m_units;
+}
+
+void LineDiff::append(Type type, int start, int end)
+{
+    if (start >= end)
+        return;
+    if (!m_units.isEmpty() && m_units.last().type == type && m_units.last().end == start)
+        m_units.last().end = end;
     else
-        units->append(Unit{type, pos, pos});
+        m_units.append(Unit{type, start, end});
+}
+
+void LineDiff::compare(int aBegin, int aEnd, int bBegin, int bEnd)
+{
+    // Strip common prefix and suffix
+    const int prefixBegin = aBegin;
+    while (aBegin < aEnd && bBegin < bEnd && m_a.at(aBegin) == m_b.at(bBegin)) {
+        ++aBegin;
+        ++bBegin;
+    }
+    append(Unchanged, prefixBegin, aBegin);
+    int suffixLength = 0;
+    while (aBegin < aEnd && bBegin < bEnd && m_a.at(aEnd - 1) == m_b.at(bEnd - 1)) {
+        --aEnd;
+        --bEnd;
+        ++suffixLength;
+    }
+
+    if (aBegin == aEnd) {
+        append(Add, bBegin, bEnd);
+    } else if (bBegin == bEnd) {
+        append(Delete, aBegin, aEnd);
+    } else {
+        // Both ranges are non-empty and differ at both ends, so the edit
+        // script has at least 2 entries and both halves are strictly smaller.
+        const Snake snake = middleSnake(aBegin, aEnd, bBegin, bEnd);
+        compare(aBegin, snake.x, bBegin, snake.y);
+        append(Unchanged, snake.x, snake.u);
+        compare(snake.u, aEnd, snake.v, bEnd);
+    }
+
+    append(Unchanged, aEnd, aEnd + suffixLength);
+}
+
+Snake LineDiff::middleSnake(int aBegin, int aEnd, int bBegin, int bEnd)
+{
+    const int n = aEnd - aBegin;
+    const int m = bEnd - bBegin;
+    const int delta = n - m;
+    const bool odd = (delta & 1) != 0;
+    const int maxD = (n + m + 1) / 2;
+    // Diagonal k = x - y is stored at offset + k, the backward search uses
+    // coordinates relative to the end (diagonal delta - k).
+    const int offset = maxD + 1;
+    int *forward = m_forward.data();
+    int *backward = m_backward.data();
+    forward[offset + 1] = 0;
+    backward[offset + 1] = 0;
+
+    for (int d = 0; d <= maxD; ++d) {
+        for (int k = -d; k <= d; k += 2) {
+            int x = k == -d || (k != d && forward[offset + k - 1] < forward[offset + k + 1])
+                ? forward[offset + k + 1] : forward[offset + k - 1] + 1;
+            int y = x - k;
+            const int startX = x;
+            const int startY = y;
+            while (x < n && y < m && m_a.at(aBegin + x) == m_b.at(bBegin + y)) {
+                ++x;
+                ++y;
+            }
+            forward[offset + k] = x;
+            const int rk = delta - k;
+            if (odd && rk >= -(d - 1) && rk <= d - 1 && x + backward[offset + rk] >= n)
+                return {aBegin + startX, bBegin + startY, aBegin + x, bBegin + y, 2 * d - 1};
+        }
+        for (int k = -d; k <= d; k += 2) {
+            int x = k == -d || (k != d && backward[offset + k - 1] < backward[offset + k + 1])
+                ? backward[offset + k + 1] : backward[offset + k - 1] + 1;
+            int y = x - k;
+            const int startX = x;
+            const int startY = y;
+            while (x < n && y < m
+                   && m_a.at(aEnd - x - 1) == m_b.at(bEnd - y - 1)) {
+                ++x;
+                ++y;
+            }
+            backward[offset + k] = x;
+            const int fk = delta - k;
+            if (!odd && fk >= -d && fk <= d && x + forward[offset + fk] >= n)
+                return {aEnd - x, bEnd - y, aEnd - startX, bEnd - startY, 2 * d};
+        }
+    }
+    Q_UNREACHABLE();
+    return {aBegin, bBegin, aBegin, bBegin, 0};
 }
 
-static QVector<Unit> diffHelper(const QVector<int> &lcs,
-                                const QByteArrayList &a, const QByteArrayList &b,
-                                int row, int col)
+static const int diffContext = 3;
+
+static void appendLines(QByteArray *out, const char *prefix,
+                        const QByteArrayList &lines, int start, int end)
 {
-    if (row > 0 && col > 0 && a.at(row - 1) == b.at(col - 1)) {
-        QVector<Unit> result = diffHelper(lcs, a, b, row - 1, col - 1);
-        unitAppend(Unchanged, row - 1, &result);
-        return result;
+    for (int i = start; i < end; ++i) {
+        out->append(prefix);
+        out->append(lines.at(i));
+        out->append('\n');
     }
+}
+
+static QByteArray hunkRange(int start, int count)
+{
+    // Unified diff convention: empty ranges refer to the line before
+    QByteArray result = QByteArray::number(count ? start + 1 : start);
+    if (count != 1) {
+        result += ',';
+        result += QByteArray::number(count);
+    }
+    return result;
+}
+
+// Format the edit script as unified diff hunks with diffContext lines of
+// context.
+static QByteArray formatHunks(const Units &units,
+                              const QByteArrayList &a, const QByteArrayList &b,
+                              bool colored)
+{
+    QByteArray result;
+    const char *info = colored ? colorInfo : "";
+    const char *del = colored ? colorDelete : "";
+    const char *add = colored ? colorAdd : "";
+    const char *reset = colored ? colorReset : "";
 
-    const int width = b.size() + 1;
-    if (col > 0
-        && (row == 0 || lcs.at(width * row + col -1 ) >= lcs.at(width * (row - 1) + col))) {
-        QVector<Unit> result = diffHelper(lcs, a, b, row, col - 1);
-        unitAppend(Add, col - 1, &result);
-        return result;
+    // Positions of the units in both sequences
+    QVector<int> aPos;
+    QVector<int> bPos;
+    aPos.reserve(units.size() + 1);
+    bPos.reserve(units.size() + 1);
+    int aLine = 0;
+    int bLine = 0;
+    for (const Unit &unit : units) {
+        aPos.append(aLine);
+        bPos.append(bLine);
+        const int length = unit.end - unit.start;
+        if (unit.type != Add)
+            aLine += length;
+        if (unit.type != Delete)
+            bLine += length;
     }
-    if (row > 0
-        && (col == 0 || lcs.at(width * row + col-1) < lcs.at(width * (row - 1) + col))) {
-        QVector<Unit> result = diffHelper(lcs, a, b, row - 1, col);
-        unitAppend(Delete, row - 1, &result);
-        return result;
+
+    const int count = units.size();
+    int i = 0;
+    while (i < count) {
+        if (units.at(i).type == Unchanged) {
+            ++i;
+            continue;
+        }
+        // Collect changes until an unchanged run exceeds twice the context
+        int last = i;
+        int j = i + 1;
+        for ( ; j < count; ++j) {
+            const Unit &unit = units.at(j);
+            if (unit.type == Unchanged) {
+                if (j + 1 >= count || unit.end - unit.start > 2 * diffContext)
+                    break;
+            } else {
+                last = j;
+            }
+        }
+
+        const int leading = i > 0
+            ? qMin(diffContext, units.at(i - 1).end - units.at(i - 1).start) : 0;
+        const int trailing = last + 1 < count
+            ? qMin(diffContext, units.at(last + 1).end - units.at(last + 1).start) : 0;
+        const int aStart = aPos.at(i) - leading;
+        const int bStart = bPos.at(i) - leading;
+        const int aEnd = (last + 1 < count ? aPos.at(last + 1) : aLine) + trailing;
+        const int bEnd = (last + 1 < count ? bPos.at(last + 1) : bLine) + trailing;
+
+        result += info;
+        result += "@@ -" + hunkRange(aStart, aEnd - aStart)
+            + " +" + hunkRange(bStart, bEnd - bStart) + " @@";
+        result += reset;
+        result += '\n';
+        appendLines(&result, " ", a, aStart, aPos.at(i));
+        for (int u = i; u <= last; ++u) {
+            const Unit &unit = units.at(u);
+            switch (unit.type) {
+            case Unchanged:
+                appendLines(&result, " ", a, unit.start, unit.end);
+                break;
+            case Add:
+                result += add;
+                appendLines(&result, "+", b, unit.start, unit.end);
+                result += reset;
+                break;
+            case Delete:
+                result += del;
+                appendLines(&result, "-", a, unit.start, unit.end);
+                result += reset;
+                break;
+            }
+        }
+        if (trailing > 0) {
+            const Unit &next = units.at(last + 1);
+            appendLines(&result, " ", a, next.start, next.start + trailing);
+        }
+        i = last + 1;
     }
-    return QVector<Unit>{};
+    return result;
+}
+
+static QByteArray diffLines(const QByteArrayList &a, const QByteArrayList &b,
+                            bool colored)
+{
+    LineDiff lineDiff(a, b);
+    return formatHunks(lineDiff.run(), a, b, colored);
 }
 
-static void diff(const QByteArrayList &a, const QByteArrayList &b)
+QByteArray FileOut::unifiedDiff(const QByteArray &original, const QByteArray &modified)
 {
-    const QVector<Unit> res = diffHelper(lcsLength(a, b), a, b, a.size(), b.size());
-    for (const Unit &unit : res)
-        unit.print(a, b);
+    return diffLines(original.split('\n'), modified.split('\n'), false);
 }
 
 FileOut::State FileOut::done()
@@ -230,7 +420,8 @@ FileOut::State FileOut::done(QString *errorMessage)
     }
     if (diff) {
         std::printf("%sFile: %s%s\n", colorInfo, qPrintable(name), colorReset);
-        ::diff(original.split('\n'), tmp.split('\n'));
+        const QByteArray hunks = diffLines(original.split('\n'), tmp.split('\n'), true);
+        std::fputs(hunks.constData(), stdout);
         std::printf("\n");
     }
 
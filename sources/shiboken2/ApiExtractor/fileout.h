@@ -57,6 +57,8 @@ public:
 
     static void touchFile(const QString &filePath);
 
+    static QByteArray unifiedDiff(const QByteArray &original, const QByteArray &modified);
+
     QTextStream stream;
 
     static bool dummy;
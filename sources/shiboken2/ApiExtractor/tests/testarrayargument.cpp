@@ -168,4 +168,49 @@ void TestArrayArgument::testArrayArgumentWithSizeDefinedByEnumValueFromGlobalEnu
     QCOMPARE(arg->type()->arrayElementType()->name(), QLatin1String("double"));
 };
 
+// The builder caches translated types; the copies handed out for equal
+// argument types must not share their array element types.
+void TestArrayArgument::testArrayTypesAreIndependent()
+{
+    const char cppCode[] ="\
+    namespace std {\n\
+    template<class T>\n\
+    class list {};\n\
+    }\n\
+    struct A {\n\
+        void m1(std::list<int> arg[2]);\n\
+        void m2(std::list<int> arg[2]);\n\
+    };\n";
+    const char xmlCode[] = "\
+    <typesystem package='Foo'>\n\
+        <primitive-type name='int'/>\n\
+        <namespace-type name='std' generate='no'/>\n\
+        <container-type name='std::list' type='list'/>\n\
+        <object-type name='A'/>\n\
+    </typesystem>\n";
+
+    QScopedPointer<AbstractMetaBuilder> builder(TestUtil::parse(cppCode, xmlCode, false));
+    QVERIFY(!builder.isNull());
+    const AbstractMetaClass *classA = AbstractMetaClass::findClass(builder->classes(), QLatin1String("A"));
+    QVERIFY(classA);
+    const AbstractMetaFunction *m1 = classA->findFunction(QLatin1String("m1"));
+    const AbstractMetaFunction *m2 = classA->findFunction(QLatin1String("m2"));
+    QVERIFY(m1);
+    QVERIFY(m2);
+
+    const AbstractMetaType *type1 = m1->arguments().constFirst()->type();
+    const AbstractMetaType *type2 = m2->arguments().constFirst()->type();
+    QVERIFY(type1 != type2);
+    QCOMPARE(type1->cppSignature(), type2->cppSignature());
+
+    const AbstractMetaType *element1 = type1->arrayElementType();
+    const AbstractMetaType *element2 = type2->arrayElementType();
+    QVERIFY(element1);
+    QVERIFY(element2);
+    QVERIFY(element1 != element2);
+    QCOMPARE(element1->instantiations().size(), 1);
+    QCOMPARE(element2->instantiations().size(), 1);
+    QVERIFY(element1->instantiations().constFirst() != element2->instantiations().constFirst());
+}
+
 QTEST_APPLESS_MAIN(TestArrayArgument)
@@ -38,6 +38,7 @@ private slots:
     void testArraySignature();
     void testArrayArgumentWithSizeDefinedByEnumValue();
     void testArrayArgumentWithSizeDefinedByEnumValueFromGlobalEnum();
+    void testArrayTypesAreIndependent();
 };
 
 #endif
@@ -46,7 +46,7 @@ void TestContainer::testContainerType()
     const char* xmlCode = "\
     <typesystem package='Foo'>\n\
         <namespace-type name='std' generate='no' />\n\
-        <container-type name='std::list' type='list' />\n\
+        <container-type name='std::list' type='list' buffer-protocol='yes' />\n\
         <object-type name='A'/>\n\
     </typesystem>\n";
 
@@ -61,6 +61,7 @@ void TestContainer::testContainerType()
     QVERIFY(baseContainer);
     QCOMPARE(reinterpret_cast<const ContainerTypeEntry*>(baseContainer)->containerKind(),
              ContainerTypeEntry::ListContainer);
+    QVERIFY(reinterpret_cast<const ContainerTypeEntry*>(baseContainer)->bufferProtocol());
 }
 
 void TestContainer::testListOfValueType()
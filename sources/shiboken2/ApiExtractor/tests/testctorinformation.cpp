@@ -73,4 +73,24 @@ void TestCtorInformation::testHasNonPrivateCtor()
     QCOMPARE(derived->hasNonPrivateConstructor(), true);
 }
 
+void TestCtorInformation::testMoveCtor()
+{
+    const char* cppCode = "class Movable { public: Movable(); Movable(const Movable &); Movable(Movable &&); };\n\
+                           class CopyOnly { public: CopyOnly(); CopyOnly(const CopyOnly &); };\n\
+                           class PrivateMove { public: PrivateMove(); PrivateMove(const PrivateMove &);\n\
+                                               private: PrivateMove(PrivateMove &&); };\n";
+    const char* xmlCode = "<typesystem package='Foo'>\n\
+                                <value-type name='Movable'/>\n\
+                                <value-type name='CopyOnly'/>\n\
+                                <value-type name='PrivateMove'/>\n\
+                           </typesystem>\n";
+    QScopedPointer<AbstractMetaBuilder> builder(TestUtil::parse(cppCode, xmlCode));
+    QVERIFY(!builder.isNull());
+    AbstractMetaClassList classes = builder->classes();
+    QCOMPARE(classes.count(), 3);
+    QCOMPARE(AbstractMetaClass::findClass(classes, QLatin1String("Movable"))->hasPublicMoveConstructor(), true);
+    QCOMPARE(AbstractMetaClass::findClass(classes, QLatin1String("CopyOnly"))->hasPublicMoveConstructor(), false);
+    QCOMPARE(AbstractMetaClass::findClass(classes, QLatin1String("PrivateMove"))->hasPublicMoveConstructor(), false);
+}
+
 QTEST_APPLESS_MAIN(TestCtorInformation)
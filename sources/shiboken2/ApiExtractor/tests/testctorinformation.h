@@ -39,6 +39,7 @@ class TestCtorInformation: public QObject
 private slots:
     void testCtorIsPrivate();
     void testHasNonPrivateCtor();
+    void testMoveCtor();
 };
 
 #endif // TESTCTORINFORMATION_H
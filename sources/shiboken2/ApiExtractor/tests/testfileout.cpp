@@ -0,0 +1,86 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of Qt for Python.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "testfileout.h"
+#include <QtTest/QTest>
+#include <fileout.h>
+
+void TestFileOut::testDiff_data()
+{
+    QTest::addColumn<QByteArray>("original");
+    QTest::addColumn<QByteArray>("modified");
+    QTest::addColumn<QByteArray>("expected");
+
+    QTest::newRow("equal")
+        << QByteArray("a\nb\n") << QByteArray("a\nb\n") << QByteArray();
+    QTest::newRow("replace")
+        << QByteArray("a\nb\nc\n") << QByteArray("a\nx\nc\n")
+        << QByteArray("@@ -1,4 +1,4 @@\n a\n-b\n+x\n c\n \n");
+    QTest::newRow("append")
+        << QByteArray("1\n2\n3\n4\n5\n6\n7\n8\n9\n10\n")
+        << QByteArray("1\n2\n3\n4\n5\n6\n7\n8\n9\n10\n11\n")
+        << QByteArray("@@ -8,4 +8,5 @@\n 8\n 9\n 10\n+11\n \n");
+    QTest::newRow("remove-first")
+        << QByteArray("1\n2\n3\n4\n5\n6\n7\n8\n")
+        << QByteArray("2\n3\n4\n5\n6\n7\n8\n")
+        << QByteArray("@@ -1,4 +1,3 @@\n-1\n 2\n 3\n 4\n");
+    QTest::newRow("two-hunks")
+        << QByteArray("1\n2\n3\n4\n5\n6\n7\n8\n9\n10\n11\n12\n")
+        << QByteArray("1\n2\nX\n4\n5\n6\n7\n8\n9\n10\nY\n12\n")
+        << QByteArray("@@ -1,6 +1,6 @@\n 1\n 2\n-3\n+X\n 4\n 5\n 6\n"
+                      "@@ -8,6 +8,6 @@\n 8\n 9\n 10\n-11\n+Y\n 12\n \n");
+}
+
+void TestFileOut::testDiff()
+{
+    QFETCH(QByteArray, original);
+    QFETCH(QByteArray, modified);
+    QFETCH(QByteArray, expected);
+    QCOMPARE(FileOut::unifiedDiff(original, modified), expected);
+}
+
+// Check that generated files of typical size can be diffed (previously
+// an O(N*M) LCS table was used).
+void TestFileOut::testLargeDiff()
+{
+    QByteArray original;
+    QByteArray modified;
+    for (int i = 0; i < 50000; ++i) {
+        const QByteArray line = "line " + QByteArray::number(i) + '\n';
+        original += line;
+        if (i % 1000 != 7)
+            modified += line;
+        if (i % 997 == 3)
+            modified += "new line\n";
+    }
+    const QByteArray diff = FileOut::unifiedDiff(original, modified);
+    QCOMPARE(diff.count("\n-"), 50);
+    QCOMPARE(diff.count("\n+"), 51);
+}
+
+QTEST_APPLESS_MAIN(TestFileOut)
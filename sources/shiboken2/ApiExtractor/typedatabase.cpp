@@ -56,6 +56,9 @@ using ApiVersions = QVector<ApiVersion>;
 
 Q_GLOBAL_STATIC(ApiVersions, apiVersions)
 
+static bool computeTypeIndexes = true;
+static int maxTypeIndex;
+
 TypeDatabase::TypeDatabase()
 {
     addType(new VoidTypeEntry());
@@ -70,6 +73,7 @@ TypeDatabase* TypeDatabase::instance(bool newInstance)
     if (!db || newInstance) {
         delete db;
         db = new TypeDatabase;
+        computeTypeIndexes = true;
     }
     return db;
 }
@@ -124,6 +128,8 @@ QStringList TypeDatabase::requiredTargetImports() const
 
 void TypeDatabase::addRequiredTargetImport(const QString& moduleName)
 {
+    if (!m_parsedImports.isEmpty() && !m_parsedImports.constLast().contains(moduleName))
+        m_parsedImports.last().append(moduleName);
     if (!m_requiredTargetImports.contains(moduleName))
         m_requiredTargetImports << moduleName;
 }
@@ -209,13 +215,13 @@ const TypeSystemTypeEntry *TypeDatabase::findTypeSystemType(const QString &name)
 
 const TypeSystemTypeEntry *TypeDatabase::defaultTypeSystemType() const
 {
-    return m_typeSystemEntries.value(0, nullptr);
+    return m_typeSystemEntries.value(m_defaultTypeSystemIndex, nullptr);
 }
 
 QString TypeDatabase::defaultPackageName() const
 {
-    Q_ASSERT(!m_typeSystemEntries.isEmpty());
-    return m_typeSystemEntries.constFirst()->name();
+    Q_ASSERT(m_defaultTypeSystemIndex < m_typeSystemEntries.size());
+    return m_typeSystemEntries.at(m_defaultTypeSystemIndex)->name();
 }
 
 TypeEntry* TypeDatabase::findType(const QString& name) const
@@ -618,8 +624,10 @@ bool TypeDatabase::parseFile(const QString &filename, const QString &currentPath
 {
 
     QString filepath = modifiedTypesystemFilepath(filename, currentPath);
-    if (m_parsedTypesystemFiles.contains(filepath))
+    if (m_parsedTypesystemFiles.contains(filepath)) {
+        addParsedImports(m_typesystemImports.value(filepath));
         return m_parsedTypesystemFiles[filepath];
+    }
 
     m_parsedTypesystemFiles[filepath] = true; // Prevent recursion when including self.
 
@@ -640,11 +648,65 @@ bool TypeDatabase::parseFile(const QString &filename, const QString &currentPath
         return false;
     }
 
+    const int typeSystemEntryCount = m_typeSystemEntries.size();
+    m_parsedImports.append(QStringList());
     bool ok = parseFile(&file, generate);
+    QStringList imports = m_parsedImports.takeLast();
+    // Also record the package of a file parsed for generation. It becomes a
+    // required import when a dependent module loads the file in batch mode.
+    if (m_typeSystemEntries.size() > typeSystemEntryCount) {
+        const QString package = m_typeSystemEntries.at(typeSystemEntryCount)->name();
+        if (!package.isEmpty() && !imports.contains(package))
+            imports.prepend(package);
+    }
+    m_typesystemImports.insert(filepath, imports);
+    addParsedImports(imports);
     m_parsedTypesystemFiles[filepath] = ok;
     return ok;
 }
 
+// Add the imports required by a type system file which has already been
+// parsed, skipping the packages being generated.
+void TypeDatabase::addParsedImports(const QStringList &imports)
+{
+    for (const QString &package : imports) {
+        const TypeSystemTypeEntry *entry = findTypeSystemType(package);
+        if (entry == nullptr || !entry->generateCode())
+            addRequiredTargetImport(package);
+    }
+}
+
+// Batch mode: Prepare the database for generating a module which loads all
+// type system files parsed so far, so that they do not need to be parsed
+// again. Their entries are turned into those of a type system loaded with
+// generate="no" and the settings of the previous module are reset.
+void TypeDatabase::prepareDependentModule()
+{
+    auto demote = [](TypeEntry *entry) {
+        if (entry->codeGeneration() == TypeEntry::GenerateCode) {
+            entry->setCodeGeneration(TypeEntry::GenerateForSubclass);
+            entry->setSbkIndex(0);
+        }
+    };
+    for (TypeEntry *entry : qAsConst(m_entries))
+        demote(entry);
+    for (TypeEntry *entry : qAsConst(m_flagsEntries))
+        demote(entry);
+    for (TypeEntry *entry : qAsConst(m_typedefEntries))
+        demote(entry);
+    for (const TypeSystemTypeEntry *entry : qAsConst(m_typeSystemEntries))
+        demote(const_cast<TypeSystemTypeEntry *>(entry));
+    m_defaultTypeSystemIndex = m_typeSystemEntries.size();
+
+    m_requiredTargetImports.clear();
+    m_globalUserFunctions.clear();
+    m_functionMods.clear();
+    m_typesystemPaths.clear();
+    m_dropTypeEntries.clear();
+    m_suppressWarnings = true;
+    computeTypeIndexes = true;
+}
+
 bool TypeDatabase::parseFile(QIODevice* device, bool generate)
 {
     QXmlStreamReader reader(device);
@@ -729,9 +791,6 @@ void TypeDatabase::setDropTypeEntries(QStringList dropTypeEntries)
     m_dropTypeEntries.sort();
 }
 
-static bool computeTypeIndexes = true;
-static int maxTypeIndex;
-
 static bool typeEntryLessThan(const TypeEntry* t1, const TypeEntry* t2)
 {
     if (t1->revision() < t2->revision())
@@ -172,6 +172,9 @@ public:
 
     bool parseFile(QIODevice *device, bool generate = true);
 
+    QStringList parsedTypesystemFiles() const { return m_parsedTypesystemFiles.keys(); }
+    void prepareDependentModule();
+
     static bool setApiVersion(const QString &package, const QString &version);
     static void clearApiVersions();
 
@@ -195,6 +198,7 @@ private:
     TypeEntry *resolveTypeDefEntry(TypedefEntry *typedefEntry, QString *errorMessage);
     template <class String>
     bool isSuppressedWarningHelper(const String &s) const;
+    void addParsedImports(const QStringList &imports);
 
     bool m_suppressWarnings = true;
     TypeEntryMultiMap m_entries; // Contains duplicate entries (cf addInlineNamespaceLookups).
@@ -202,7 +206,8 @@ private:
     TypedefEntryMap m_typedefEntries;
     TemplateEntryMap m_templates;
     QVector<QRegularExpression> m_suppressedWarnings;
-    QVector<const TypeSystemTypeEntry *> m_typeSystemEntries; // maintain order, default is first.
+    QVector<const TypeSystemTypeEntry *> m_typeSystemEntries; // maintain order, default is first
+    int m_defaultTypeSystemIndex = 0; // of the module being generated (batch mode).
 
     AddedFunctionList m_globalUserFunctions;
     FunctionModificationList m_functionMods;
@@ -211,6 +216,8 @@ private:
 
     QStringList m_typesystemPaths;
     QHash<QString, bool> m_parsedTypesystemFiles;
+    QHash<QString, QStringList> m_typesystemImports; // Required imports per parsed file
+    QVector<QStringList> m_parsedImports; // Imports of the files being parsed
 
     QVector<TypeRejection> m_rejections;
 
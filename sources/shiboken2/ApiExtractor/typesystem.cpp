@@ -656,7 +656,9 @@ ComplexTypeEntry::ComplexTypeEntry(const QString &entryName, TypeEntry::Type t,
     m_qualifiedCppName(buildName(entryName, parent)),
     m_polymorphicBase(false),
     m_genericClass(false),
-    m_deleteInMainThread(false)
+    m_deleteInMainThread(false),
+    m_inlineStorage(false),
+    m_gcTracking(true)
 {
 }
 
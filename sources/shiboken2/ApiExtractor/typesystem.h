@@ -855,6 +855,12 @@ public:
 
     bool isCppPrimitive() const;
 
+    /// Struct format (PEP 3118) of the type if it is a plain aggregate of
+    /// equal primitive members ("dd" for QPointF). Contiguous containers of
+    /// such types are exchanged with Python buffers.
+    QString bufferFormat() const { return m_bufferFormat; }
+    void setBufferFormat(const QString &f) { m_bufferFormat = f; }
+
     bool hasCustomConversion() const;
     void setCustomConversion(CustomConversion* customConversion);
     CustomConversion* customConversion() const;
@@ -890,6 +896,7 @@ private:
     IncludeList m_extraIncludes;
     Include m_include;
     QString m_conversionRule;
+    QString m_bufferFormat;
     QVersionNumber m_version;
     CustomConversion *m_customConversion = nullptr;
     SourceLocation m_sourceLocation; // XML file
@@ -1323,6 +1330,19 @@ public:
     bool deleteInMainThread() const { return m_deleteInMainThread; }
     void setDeleteInMainThread(bool d) { m_deleteInMainThread = d; }
 
+    /// Value type whose C++ instances are constructed inside the Python
+    /// wrapper instead of being allocated separately.
+    bool inlineStorage() const { return m_inlineStorage; }
+    void setInlineStorage(bool i) { m_inlineStorage = i; }
+
+    /// Number of deallocated Python wrappers kept for reuse, 0 if disabled.
+    int freeListSize() const { return m_freeListSize; }
+    void setFreeListSize(int s) { m_freeListSize = s; }
+
+    /// Whether the Python wrappers are tracked by the garbage collector.
+    bool gcTracking() const { return m_gcTracking; }
+    void setGcTracking(bool t) { m_gcTracking = t; }
+
     CopyableFlag copyable() const
     {
         return m_copyableFlag;
@@ -1383,11 +1403,14 @@ private:
     uint m_polymorphicBase : 1;
     uint m_genericClass : 1;
     uint m_deleteInMainThread : 1;
+    uint m_inlineStorage : 1;
+    uint m_gcTracking : 1;
 
     QString m_polymorphicIdValue;
     QString m_targetType;
     TypeFlags m_typeFlags;
     CopyableFlag m_copyableFlag = Unknown;
+    int m_freeListSize = 0;
     QString m_hashFunction;
 
     const ComplexTypeEntry* m_baseContainerType = nullptr;
@@ -1461,6 +1484,11 @@ public:
     QString typeName() const;
     QString qualifiedCppName() const override;
 
+    /// Vectors of element types having a buffer format are converted to
+    /// Python buffers of that format instead of using the conversion rule.
+    bool bufferProtocol() const { return m_bufferProtocol; }
+    void setBufferProtocol(bool b) { m_bufferProtocol = b; }
+
     TypeEntry *clone() const override;
 
 #ifndef QT_NO_DEBUG_STREAM
@@ -1471,6 +1499,7 @@ protected:
 
 private:
     ContainerKind m_containerKind;
+    bool m_bufferProtocol = false;
 };
 
 class SmartPointerTypeEntry : public ComplexTypeEntry
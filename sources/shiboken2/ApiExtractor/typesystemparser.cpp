@@ -48,6 +48,8 @@ const char *NATIVE_CONVERSION_RULE_FLAG = "1";
 
 static inline QString allowThreadAttribute() { return QStringLiteral("allow-thread"); }
 static inline QString colonColon() { return QStringLiteral("::"); }
+static inline QString bufferFormatAttribute() { return QStringLiteral("buffer-format"); }
+static inline QString bufferProtocolAttribute() { return QStringLiteral("buffer-protocol"); }
 static inline QString copyableAttribute() { return QStringLiteral("copyable"); }
 static inline QString accessAttribute() { return QStringLiteral("access"); }
 static inline QString actionAttribute() { return QStringLiteral("action"); }
@@ -59,6 +61,9 @@ static inline QString sinceAttribute() { return QStringLiteral("since"); }
 static inline QString untilAttribute() { return QStringLiteral("until"); }
 static inline QString defaultSuperclassAttribute() { return QStringLiteral("default-superclass"); }
 static inline QString deleteInMainThreadAttribute() { return QStringLiteral("delete-in-main-thread"); }
+static inline QString inlineStorageAttribute() { return QStringLiteral("inline-storage"); }
+static inline QString freeListSizeAttribute() { return QStringLiteral("free-list-size"); }
+static inline QString gcTrackingAttribute() { return QStringLiteral("gc-tracking"); }
 static inline QString deprecatedAttribute() { return QStringLiteral("deprecated"); }
 static inline QString exceptionHandlingAttribute() { return QStringLiteral("exception-handling"); }
 static inline QString extensibleAttribute() { return QStringLiteral("extensible"); }
@@ -1265,6 +1270,8 @@ PrimitiveTypeEntry *
             type->setPreferredTargetLangType(v);
         } else if (name == QLatin1String("default-constructor")) {
              type->setDefaultConstructor(attributes->takeAt(i).value().toString());
+        } else if (name == bufferFormatAttribute()) {
+            type->setBufferFormat(attributes->takeAt(i).value().toString());
         }
     }
 
@@ -1294,6 +1301,11 @@ ContainerTypeEntry *
     }
     auto *type = new ContainerTypeEntry(name, containerType, since, currentParentTypeEntry());
     applyCommonAttributes(reader, type, attributes);
+    const int bufferProtocolIndex = indexOfAttribute(*attributes, bufferProtocolAttribute());
+    if (bufferProtocolIndex != -1) {
+        type->setBufferProtocol(convertBoolean(attributes->takeAt(bufferProtocolIndex).value(),
+                                               bufferProtocolAttribute(), false));
+    }
     return type;
 }
 
@@ -1529,6 +1541,8 @@ void TypeSystemParser::applyComplexTypeAttributes(const QXmlStreamReader &reader
                       qPrintable(msgUnimplementedAttributeWarning(reader, name)));
         } else if (name == QLatin1String("hash-function")) {
             ctype->setHashFunction(attributes->takeAt(i).value().toString());
+        } else if (name == bufferFormatAttribute()) {
+            ctype->setBufferFormat(attributes->takeAt(i).value().toString());
         } else if (name == forceAbstractAttribute()) {
             qCWarning(lcShiboken, "%s",
                       qPrintable(msgUnimplementedAttributeWarning(reader, name)));
@@ -1538,6 +1552,21 @@ void TypeSystemParser::applyComplexTypeAttributes(const QXmlStreamReader &reader
         } else if (name == deleteInMainThreadAttribute()) {
             if (convertBoolean(attributes->takeAt(i).value(), deleteInMainThreadAttribute(), false))
                 ctype->setDeleteInMainThread(true);
+        } else if (name == inlineStorageAttribute()) {
+            if (convertBoolean(attributes->takeAt(i).value(), inlineStorageAttribute(), false))
+                ctype->setInlineStorage(true);
+        } else if (name == freeListSizeAttribute()) {
+            const auto attribute = attributes->takeAt(i);
+            bool ok;
+            const int size = attribute.value().toInt(&ok);
+            if (ok && size >= 0) {
+                ctype->setFreeListSize(size);
+            } else {
+                qCWarning(lcShiboken, "%s",
+                          qPrintable(msgInvalidAttributeValue(attribute)));
+            }
+        } else if (name == gcTrackingAttribute()) {
+            ctype->setGcTracking(convertBoolean(attributes->takeAt(i).value(), gcTrackingAttribute(), true));
         } else if (name == QLatin1String("target-type")) {
             ctype->setTargetType(attributes->takeAt(i).value().toString());
         }
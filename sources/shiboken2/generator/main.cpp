@@ -30,9 +30,14 @@
 #include <QLibrary>
 #include <QtCore/QFile>
 #include <QtCore/QDir>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QSet>
+#include <QtCore/QXmlStreamReader>
+#include <algorithm>
 #include <iostream>
 #include <apiextractor.h>
 #include <fileout.h>
+#include <graph.h>
 #include <reporthandler.h>
 #include <typedatabase.h>
 #include <messages.h>
@@ -57,6 +62,7 @@ static inline QString helpOption() { return QStringLiteral("help"); }
 static inline QString diffOption() { return QStringLiteral("diff"); }
 static inline QString dryrunOption() { return QStringLiteral("dry-run"); }
 static inline QString skipDeprecatedOption() { return QStringLiteral("skip-deprecated"); }
+static inline QString batchOption() { return QStringLiteral("batch"); }
 
 static const char helpHint[] = "Note: use --help or -h for more information.\n";
 
@@ -295,6 +301,11 @@ void printUsage()
     OptionDescriptions generalOptions = OptionDescriptions()
         << qMakePair(QLatin1String("api-version=<\"package mask\">,<\"version\">"),
                      QLatin1String("Specify the supported api version used to generate the bindings"))
+        << qMakePair(batchOption() + QLatin1String("=<project-file>[") + pathSplitter
+                     + QLatin1String("<project-file>...]"),
+                     QLatin1String("Generate the modules described by the project files in\n"
+                                   "dependency order within one process, reusing the parsed type\n"
+                                   "systems of a module for the modules depending on it"))
         << qMakePair(QLatin1String("debug-level=[sparse|medium|full]"),
                      QLatin1String("Set the debug level"))
         << qMakePair(QLatin1String("documentation-only"),
@@ -382,21 +393,191 @@ static void parseIncludePathOption(const QString &option, HeaderType headerType,
     }
 }
 
-int main(int argc, char *argv[])
+static int generateModule(CommandLineArguments args,
+                          const CommandLineArguments &projectFileArguments);
+
+// Batch mode: Generate several modules described by project files in
+// dependency order within this process. The type database is kept for the
+// next module if that module loads all type system files parsed so far
+// (typically a module depending on the previous one), so that they are not
+// parsed again. Otherwise, a new type database is created.
+
+struct BatchModule
 {
-    // PYSIDE-757: Request a deterministic ordering of QHash in the code model
-    // and type system.
-    qSetGlobalQHashSeed(0);
-    // needed by qxmlpatterns
-    QCoreApplication app(argc, argv);
-    ReportHandler::install();
-    if (ReportHandler::isDebug(ReportHandler::SparseDebug))
-        qCInfo(lcShiboken()).noquote().nospace() << QCoreApplication::arguments().join(QLatin1Char(' '));
+    enum State { Pending, Done, Failed };
+
+    QString projectFile;
+    CommandLineArguments projectArguments;
+    QString name;
+    QString typeSystemFile; // Absolute path
+    QStringList typeSystemPaths;
+    QSet<QString> loadedTypeSystems; // Absolute paths, recursively
+    QVector<int> dependencies;
+    State state = Pending;
+};
 
-    // Store command arguments in a map
-    const CommandLineArguments projectFileArguments = getProjectFileArguments();
-    CommandLineArguments args = projectFileArguments;
-    getCommandLineArgs(args);
+static QString resolveTypeSystemFile(const QString &fileName, const QString &currentPath,
+                                     const QStringList &typeSystemPaths)
+{
+    const QFileInfo fi(fileName);
+    if (fi.isAbsolute() || fi.isFile())
+        return fi.absoluteFilePath();
+    const QFileInfo currentFi(currentPath + QLatin1Char('/') + fileName);
+    if (currentFi.isFile())
+        return currentFi.absoluteFilePath();
+    for (const QString &path : typeSystemPaths) {
+        const QFileInfo pathFi(path + QLatin1Char('/') + fileName);
+        if (pathFi.isFile())
+            return pathFi.absoluteFilePath();
+    }
+    return QString();
+}
+
+// Recursively collect the file names of the type systems loaded by a type
+// system file via <load-typesystem>.
+static void collectLoadedTypeSystems(const QString &typeSystemFile,
+                                     const QStringList &typeSystemPaths,
+                                     QSet<QString> *result)
+{
+    QFile file(typeSystemFile);
+    if (!file.open(QIODevice::ReadOnly))
+        return;
+    const QString currentPath = QFileInfo(typeSystemFile).absolutePath();
+    QXmlStreamReader reader(&file);
+    while (!reader.atEnd()) {
+        if (reader.readNext() != QXmlStreamReader::StartElement
+            || reader.name() != QLatin1String("load-typesystem")) {
+            continue;
+        }
+        const QString name = reader.attributes().value(QLatin1String("name")).toString();
+        const QString resolved = resolveTypeSystemFile(name, currentPath, typeSystemPaths);
+        if (!resolved.isEmpty() && !result->contains(resolved)) {
+            result->insert(resolved);
+            collectLoadedTypeSystems(resolved, typeSystemPaths, result);
+        }
+    }
+}
+
+static bool readBatchModule(const QString &projectFileName, BatchModule *module,
+                            QString *errorMessage)
+{
+    QFile projectFile(projectFileName);
+    if (!projectFile.open(QIODevice::ReadOnly)) {
+        *errorMessage = msgCannotOpenForReading(projectFile);
+        return false;
+    }
+    CommandLineArguments args;
+    if (!processProjectFile(projectFile, args) || args.positionalArguments.isEmpty()) {
+        *errorMessage = QLatin1String("Invalid project file: ")
+            + QDir::toNativeSeparators(projectFileName);
+        return false;
+    }
+    module->projectFile = projectFileName;
+    module->projectArguments = args;
+    module->typeSystemPaths =
+        args.options.value(typesystemPathOption()).split(pathSplitter, Qt::SkipEmptyParts);
+    const QString typeSystemFile = args.positionalArguments.constLast();
+    module->typeSystemFile = resolveTypeSystemFile(typeSystemFile, QDir::currentPath(),
+                                                   module->typeSystemPaths);
+    if (module->typeSystemFile.isEmpty()) {
+        *errorMessage = QLatin1String("Type system file \"") + typeSystemFile
+            + QLatin1String("\" of ") + QDir::toNativeSeparators(projectFileName)
+            + QLatin1String(" does not exist.");
+        return false;
+    }
+    module->name = QFileInfo(module->typeSystemFile).baseName();
+    return true;
+}
+
+// Prepare the type database for generating a module.
+static void prepareTypeDatabase(const BatchModule &module)
+{
+    TypeDatabase *db = TypeDatabase::instance();
+    const QStringList parsedFiles = db->parsedTypesystemFiles();
+    if (!parsedFiles.isEmpty()) {
+        const bool reuse = std::all_of(parsedFiles.cbegin(), parsedFiles.cend(),
+                                       [&module](const QString &f) {
+                                           return module.loadedTypeSystems.contains(f);
+                                       });
+        if (reuse)
+            db->prepareDependentModule();
+        else
+            TypeDatabase::instance(true);
+    }
+    TypeDatabase::clearApiVersions();
+}
+
+static int runBatch(const CommandLineArguments &args)
+{
+    const QStringList projectFiles =
+        args.options.value(batchOption()).split(pathSplitter, Qt::SkipEmptyParts);
+    if (projectFiles.isEmpty()) {
+        errorPrint(QLatin1String("No project files specified for --batch."));
+        return EXIT_FAILURE;
+    }
+
+    QVector<BatchModule> modules(projectFiles.size());
+    QString errorMessage;
+    for (int i = 0, size = projectFiles.size(); i < size; ++i) {
+        if (!readBatchModule(projectFiles.at(i), &modules[i], &errorMessage)) {
+            errorPrint(errorMessage);
+            return EXIT_FAILURE;
+        }
+    }
+
+    Graph graph(modules.size());
+    for (int i = 0, size = modules.size(); i < size; ++i) {
+        BatchModule &module = modules[i];
+        collectLoadedTypeSystems(module.typeSystemFile, module.typeSystemPaths,
+                                 &module.loadedTypeSystems);
+        for (int d = 0; d < size; ++d) {
+            if (d != i && module.loadedTypeSystems.contains(modules.at(d).typeSystemFile)) {
+                module.dependencies.append(d);
+                graph.addEdge(d, i);
+            }
+        }
+    }
+    const Graph::Indexes order = graph.topologicalSort();
+    if (order.isEmpty()) {
+        errorPrint(QLatin1String("Cyclic dependency between the batch modules."));
+        return EXIT_FAILURE;
+    }
+
+    bool failed = false;
+    for (int index : order) {
+        BatchModule &module = modules[index];
+        const bool dependencyFailed =
+            std::any_of(module.dependencies.cbegin(), module.dependencies.cend(),
+                        [&modules](int d) { return modules.at(d).state == BatchModule::Failed; });
+        if (dependencyFailed) {
+            module.state = BatchModule::Failed;
+            std::cerr << "shiboken: Skipping " << qPrintable(module.name)
+                << " due to failed dependencies.\n";
+            continue;
+        }
+
+        prepareTypeDatabase(module);
+        // Command line options apply to all modules as for --project-file.
+        CommandLineArguments moduleArguments = module.projectArguments;
+        getCommandLineArgs(moduleArguments);
+        moduleArguments.options.remove(batchOption());
+        if (generateModule(moduleArguments, module.projectArguments) == EXIT_SUCCESS) {
+            module.state = BatchModule::Done;
+        } else {
+            module.state = BatchModule::Failed;
+            failed = true;
+            std::cerr << "shiboken: Generating " << qPrintable(module.name) << " failed.\n";
+            TypeDatabase::instance(true);
+        }
+    }
+    return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+// Generate a module from the arguments obtained from the command line and
+// the project file.
+static int generateModule(CommandLineArguments args,
+                          const CommandLineArguments &projectFileArguments)
+{
     Generators generators;
 
     auto ait = args.options.find(QLatin1String("version"));
@@ -633,8 +814,14 @@ int main(int argc, char *argv[])
         g->setOutputDirectory(outputDirectory);
         g->setLicenseComment(licenseComment);
         ReportHandler::startProgress(QByteArray("Running ") + g->name() + "...");
+        QElapsedTimer timer;
+        timer.start();
         const bool ok = g->setup(extractor) && g->generate();
         ReportHandler::endProgress();
+        if (ReportHandler::isDebug(ReportHandler::SparseDebug)) {
+            qCInfo(lcShiboken).noquote().nospace()
+                << "Generating (" << g->name() << "): " << timer.elapsed() << "ms";
+        }
          if (!ok) {
              errorPrint(QLatin1String("Error running generator: ")
                         + QLatin1String(g->name()) + QLatin1Char('.'));
@@ -647,3 +834,23 @@ int main(int argc, char *argv[])
 
     return EXIT_SUCCESS;
 }
+
+int main(int argc, char *argv[])
+{
+    // PYSIDE-757: Request a deterministic ordering of QHash in the code model
+    // and type system.
+    qSetGlobalQHashSeed(0);
+    // needed by qxmlpatterns
+    QCoreApplication app(argc, argv);
+    ReportHandler::install();
+    if (ReportHandler::isDebug(ReportHandler::SparseDebug))
+        qCInfo(lcShiboken()).noquote().nospace() << QCoreApplication::arguments().join(QLatin1Char(' '));
+
+    // Store command arguments in a map
+    const CommandLineArguments projectFileArguments = getProjectFileArguments();
+    CommandLineArguments args = projectFileArguments;
+    getCommandLineArgs(args);
+    if (args.options.contains(batchOption()))
+        return runBatch(args);
+    return generateModule(args, projectFileArguments);
+}
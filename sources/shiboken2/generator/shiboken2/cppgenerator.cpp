@@ -375,6 +375,10 @@ void CppGenerator::generateClass(QTextStream &s, const GeneratorContext &classCo
     if (metaClass->generateExceptionHandling())
         s << "#include <exception>\n";
     s << "#include <iterator>\n"; // For containers
+    if (hasMoveToPythonConversion(metaClass))
+        s << "#include <utility>\n";
+    if (useInlineStorage(metaClass))
+        s << "#include <new>\n#include <type_traits>\n";
 
     if (wrapperDiagnostics())
         s << "#include <helper.h>\n#include <iostream>\n";
@@ -458,6 +462,7 @@ void CppGenerator::generateClass(QTextStream &s, const GeneratorContext &classCo
 
     if (classContext.useWrapper()) {
         s << "// Native ---------------------------------------------------------\n\n";
+        s << "extern PyObject *" << methodNamesVariableName() << "[];\n\n";
 
         if (avoidProtectedHack() && usePySideExtensions()) {
             s << "void " << classContext.wrapperName() << "::pysideInitQtMetaTypes()\n{\n";
@@ -949,6 +954,58 @@ QString CppGenerator::virtualMethodReturn(QTextStream &s,
            + QLatin1Char(';');
 }
 
+// Returns the snake_case form of a method name, following
+// Shiboken::String::getSnakeCaseName().
+static QString snakeCaseName(const QString &name)
+{
+    if (name.size() < 3
+        || (name.startsWith(QLatin1String("gl")) && name.at(2).isUpper())) {
+        return name;
+    }
+    QString result;
+    for (int i = 0, size = name.size(); i < size; ++i) {
+        const QChar c = name.at(i);
+        if (c.isUpper()) {
+            if (i > 0 && name.at(i - 1).isUpper())
+                return name;
+            result += QLatin1Char('_');
+            result += c.toLower();
+        } else {
+            result += c;
+        }
+    }
+    return result;
+}
+
+// Returns the index of a method name in the table of the module. The table
+// holds the name and its snake_case form, which are interned at import.
+int CppGenerator::methodNameIndex(const QString &name)
+{
+    auto it = m_methodNameIndexes.constFind(name);
+    if (it != m_methodNameIndexes.cend())
+        return it.value();
+    const int result = m_methodNames.size();
+    m_methodNames << name << snakeCaseName(name);
+    m_methodNameIndexes.insert(name, result);
+    return result;
+}
+
+void CppGenerator::writeMethodNamesTable(QTextStream &s) const
+{
+    if (m_methodNames.isEmpty())
+        return;
+    s << "// Names of the virtual methods followed by their snake_case forms.\n";
+    s << "static const char methodNameStrings[] =\n";
+    {
+        Indentation indent(INDENT);
+        for (int i = 0, size = m_methodNames.size(); i < size; ++i) {
+            s << INDENT << '"' << m_methodNames.at(i) << "\\0\"";
+            s << (i + 1 < size ? "\n" : ";\n");
+        }
+    }
+    s << "PyObject *" << methodNamesVariableName() << '[' << m_methodNames.size() << "];\n\n";
+}
+
 void CppGenerator::writeVirtualMethodNative(QTextStream &s,
                                             const AbstractMetaFunction *func,
                                             int cacheIndex)
@@ -1025,16 +1082,13 @@ void CppGenerator::writeVirtualMethodNative(QTextStream &s,
         propFlag |= 2;
     if (propFlag && func->isStatic())
         propFlag |= 4;
-    QString propStr;
-    if (propFlag)
-        propStr = QString::number(propFlag) + QLatin1Char(':');
 
-    s << INDENT << "static PyObject *nameCache[2] = {};\n";
     if (propFlag)
         s << INDENT << "// This method belongs to a property.\n";
-    s << INDENT << "static const char *funcName = \"" << propStr << funcName << "\";\n";
     s << INDENT << "Shiboken::AutoDecRef " << PYTHON_OVERRIDE_VAR
-                << "(Shiboken::BindingManager::instance().getOverride(this, nameCache, funcName));\n";
+        << "(Shiboken::BindingManager::instance().getOverride(this, &"
+        << methodNamesVariableName() << '[' << methodNameIndex(funcName) << "], "
+        << propFlag << "));\n";
     s << INDENT << "if (" << PYTHON_OVERRIDE_VAR << ".isNull()) {\n"
        << indent(INDENT) << INDENT << "gil.release();\n";
     if (useOverrideCaching(func->ownerClass()))
@@ -1481,12 +1535,47 @@ void CppGenerator::writeConverterFunctions(QTextStream &s, const AbstractMetaCla
         computedWrapperName = classContext.smartPointerWrapperName();
     }
 
+    // Copies of types using inline storage are constructed inside the wrapper.
+    const bool inlineStorage = !classContext.forSmartPointer() && useInlineStorage(metaClass);
+    auto writeInlineCopy = [&](const QString &ctorArgument) {
+        c << nested << "void *cppStorage{};\n"
+            << nested << "if (PyObject *pyOut = Shiboken::Object::newInlineObject("
+            << cpythonType << ", &cppStorage)) {\n"
+            << nested << "    new (cppStorage) ::" << computedWrapperName << '('
+            << ctorArgument << ");\n"
+            << nested << "    return pyOut;\n"
+            << nested << "}\n";
+    };
+    const QString copyArgument = QLatin1String("*reinterpret_cast<const ")
+        + typeName + QLatin1String(" *>(cppIn)");
+    if (inlineStorage) {
+        s << "static_assert(std::is_nothrow_copy_constructible< ::" << computedWrapperName
+            << " >::value,\n              \"inline-storage requires a copy constructor which does not throw\");\n";
+        writeInlineCopy(copyArgument);
+    }
     c << nested << "return Shiboken::Object::newObject(" << cpythonType
-        << ", new ::" << computedWrapperName << "(*reinterpret_cast<const "
-        << typeName << " *>(cppIn)), true, true);";
+        << ", new ::" << computedWrapperName << '(' << copyArgument << "), true, true);";
     writeCppToPythonFunction(s, code, sourceTypeName, targetTypeName);
     s << Qt::endl;
 
+    // Moves C++ values returned by functions to a new Python wrapper.
+    if (!classContext.forSmartPointer() && hasMoveToPythonConversion(metaClass)) {
+        s << "// C++ to Python move conversion.\n";
+        sourceTypeName = targetTypeName + QLatin1String("_MOVE");
+        code.clear();
+        const QString moveArgument = QLatin1String("std::move(*reinterpret_cast<")
+            + typeName + QLatin1String(" *>(const_cast<void *>(cppIn)))");
+        if (inlineStorage) {
+            s << "static_assert(std::is_nothrow_move_constructible< ::" << computedWrapperName
+                << " >::value,\n              \"inline-storage requires a move constructor which does not throw\");\n";
+            writeInlineCopy(moveArgument);
+        }
+        c << nested << "return Shiboken::Object::newObject(" << cpythonType
+            << ", new ::" << computedWrapperName << '(' << moveArgument << "), true, true);";
+        writeCppToPythonFunction(s, code, sourceTypeName, targetTypeName);
+        s << Qt::endl;
+    }
+
     // Python to C++ copy conversion.
     s << "// Python to C++ copy conversion.\n";
     if (!classContext.forSmartPointer())
@@ -1608,6 +1697,28 @@ void CppGenerator::writeCustomConverterFunctions(QTextStream &s, const CustomCon
     s << Qt::endl;
 }
 
+// Write the names of a converter as one literal of '\0' separated names, which
+// stays in read-only memory and is not copied by libshiboken.
+void CppGenerator::writeRegisterConverterNames(QTextStream &s, const QString &converter,
+                                               const QStringList &names)
+{
+    if (names.isEmpty())
+        return;
+    if (names.size() == 1) {
+        s << INDENT << "Shiboken::Conversions::registerConverterName(" << converter
+            << ", \"" << names.constFirst() << "\");\n";
+        return;
+    }
+    s << INDENT << "Shiboken::Conversions::registerConverterNames(" << converter << ",\n";
+    {
+        Indentation indent(INDENT);
+        for (int i = 0, size = names.size(); i < size; ++i) {
+            s << INDENT << '"' << names.at(i) << "\\0\"";
+            s << (i + 1 < size ? "\n" : ");\n");
+        }
+    }
+}
+
 void CppGenerator::writeConverterRegister(QTextStream &s, const AbstractMetaClass *metaClass,
                                           const GeneratorContext &classContext)
 {
@@ -1631,14 +1742,20 @@ void CppGenerator::writeConverterRegister(QTextStream &s, const AbstractMetaClas
         }
     }
     s << ");\n";
+    if (!classContext.forSmartPointer() && hasMoveToPythonConversion(metaClass)) {
+        const QString targetTypeName = metaClass->name();
+        const QString sourceTypeName = targetTypeName + QLatin1String("_MOVE");
+        s << INDENT << "Shiboken::Conversions::setCppMoveToPythonFunction(converter, "
+            << cppToPythonFunctionName(sourceTypeName, targetTypeName) << ");\n";
+    }
 
     s << Qt::endl;
 
-    auto writeConversions = [&s, this](const QString &signature)
+    QStringList converterNames;
+    auto writeConversions = [&converterNames](const QString &signature)
     {
-        s << INDENT << "Shiboken::Conversions::registerConverterName(converter, \"" << signature << "\");\n";
-        s << INDENT << "Shiboken::Conversions::registerConverterName(converter, \"" << signature << "*\");\n";
-        s << INDENT << "Shiboken::Conversions::registerConverterName(converter, \"" << signature << "&\");\n";
+        converterNames << signature << signature + QLatin1Char('*')
+            << signature + QLatin1Char('&');
     };
 
     auto writeConversionsForType = [writeConversions](const QString &fullTypeName)
@@ -1669,6 +1786,7 @@ void CppGenerator::writeConverterRegister(QTextStream &s, const AbstractMetaClas
 
         writeConversionsForType(smartPointerType);
     }
+    writeRegisterConverterNames(s, QLatin1String("converter"), converterNames);
 
     s << INDENT << "Shiboken::Conversions::registerConverterName(converter, typeid(::";
     QString qualifiedCppNameInvocation;
@@ -1814,6 +1932,8 @@ void CppGenerator::writeMethodWrapperPreamble(QTextStream &s, OverloadData &over
             s << context.smartPointerWrapperName();
         }
         s << " *cptr{};\n";
+        if (!context.forSmartPointer() && useInlineStorage(ownerClass))
+            s << INDENT << "void *inlineStorage = Shiboken::Object::inlineCppStorage(reinterpret_cast<SbkObject *>(self));\n";
 
         initPythonArguments = maxArgs > 0;
         usesNamedArguments = !ownerClass->isQObject() && overloadData.hasArgumentWithDefaultValue();
@@ -1910,7 +2030,15 @@ void CppGenerator::writeConstructorWrapper(QTextStream &s, const AbstractMetaFun
     s << INDENT << "if (PyErr_Occurred() || !Shiboken::Object::setCppPointer(sbkSelf, Shiboken::SbkType< ::" << metaClass->qualifiedCppName() << " >(), cptr)) {\n";
     {
         Indentation indent(INDENT);
-        s << INDENT << "delete cptr;\n";
+        if (useInlineStorage(metaClass)) {
+            s << INDENT << "if (cptr != nullptr && static_cast<void *>(cptr) == inlineStorage)\n"
+                << INDENT << "    Shiboken::callCppInPlaceDestructor< ::"
+                << metaClass->qualifiedCppName() << " >(cptr);\n"
+                << INDENT << "else\n" << INDENT << "    ";
+        } else {
+            s << INDENT;
+        }
+        s << "delete cptr;\n";
         if (overloadData.maxArgs() > 0)
             s << INDENT << "Py_XDECREF(errInfo);\n";
         s << INDENT << returnStatement(m_currentErrorCode) << Qt::endl;
@@ -2136,7 +2264,13 @@ void CppGenerator::writeArgumentsInitializer(QTextStream &s, OverloadData &overl
 
     s << INDENT << "// invalid argument lengths\n";
     bool ownerClassIsQObject = rfunc->ownerClass() && rfunc->ownerClass()->isQObject() && rfunc->isConstructor();
-    if (usesNamedArguments) {
+    const bool checkArgumentCount = usesNamedArguments && (!ownerClassIsQObject || minArgs > 0);
+    if (checkArgumentCount && compactArgumentParsing()) {
+        s << INDENT << "if (!Shiboken::checkArgumentCount(numArgs, " << minArgs << ", "
+            << (ownerClassIsQObject ? -1 : maxArgs) << ", &errInfo))\n";
+        Indentation indent(INDENT);
+        s << INDENT << "goto " << cpythonFunctionName(rfunc) << "_TypeError;\n";
+    } else if (usesNamedArguments) {
         if (!ownerClassIsQObject) {
             s << INDENT << "if (numArgs > " << maxArgs << ") {\n";
             {
@@ -2171,7 +2305,7 @@ void CppGenerator::writeArgumentsInitializer(QTextStream &s, OverloadData &overl
         QStringList invArgsLen;
         for (int i : qAsConst(invalidArgsLength))
             invArgsLen << QStringLiteral("numArgs == %1").arg(i);
-        if (usesNamedArguments && (!ownerClassIsQObject || minArgs > 0))
+        if (checkArgumentCount && !compactArgumentParsing())
             s << " else ";
         else
             s << INDENT;
@@ -2299,9 +2433,14 @@ void CppGenerator::writeErrorSection(QTextStream &s, OverloadData &overloadData)
 
     QString argsVar = pythonFunctionWrapperUsesListOfArguments(overloadData)
         ? QLatin1String("args") : QLatin1String(PYTHON_ARG);
-    s << INDENT << "Shiboken::setErrorAboutWrongArguments(" << argsVar
-                << ", fullName, errInfo);\n";
-    s << INDENT << "Py_XDECREF(errInfo);\n";
+    if (compactArgumentParsing()) {
+        s << INDENT << "Shiboken::setErrorAboutWrongArgumentsStealInfo(" << argsVar
+                    << ", fullName, errInfo);\n";
+    } else {
+        s << INDENT << "Shiboken::setErrorAboutWrongArguments(" << argsVar
+                    << ", fullName, errInfo);\n";
+        s << INDENT << "Py_XDECREF(errInfo);\n";
+    }
     s << INDENT << "return " << m_currentErrorCode << ";\n";
 }
 
@@ -2444,11 +2583,12 @@ void CppGenerator::writeArgumentConversion(QTextStream &s,
                                            const QString &argName, const QString &pyArgName,
                                            const AbstractMetaClass *context,
                                            const QString &defaultValue,
-                                           bool castArgumentAsUnused)
+                                           bool castArgumentAsUnused,
+                                           bool checkValidity)
 {
     if (argType->typeEntry()->isCustom() || argType->typeEntry()->isVarargs())
         return;
-    if (isWrapperType(argType))
+    if (checkValidity && isWrapperType(argType))
         writeInvalidPyObjectCheck(s, pyArgName);
     writePythonToCppTypeConversion(s, argType, pyArgName, argName, context, defaultValue);
     if (castArgumentAsUnused)
@@ -2910,6 +3050,11 @@ void CppGenerator::writeSingleFunctionCall(QTextStream &s,
     bool injectCodeCallsFunc = injectedCodeCallsCppFunction(context, func);
     bool mayHaveUnunsedArguments = !func->isUserAdded() && func->hasInjectedCode() && injectCodeCallsFunc;
     int removedArgs = 0;
+    // With compact argument parsing, the validity of the wrapper arguments is
+    // checked by one call before the conversions.
+    QString conversions;
+    QTextStream c(&conversions);
+    unsigned validityMask = 0;
     for (int argIdx = 0; argIdx < func->arguments().count(); ++argIdx) {
         bool hasConversionRule = !func->conversionRule(TypeSystem::NativeCode, argIdx + 1).isEmpty();
         const AbstractMetaArgument *arg = func->arguments().at(argIdx);
@@ -2917,9 +3062,9 @@ void CppGenerator::writeSingleFunctionCall(QTextStream &s,
             if (!arg->defaultValueExpression().isEmpty()) {
                 const QString cppArgRemoved = QLatin1String(CPP_ARG_REMOVED)
                     + QString::number(argIdx);
-                s << INDENT << getFullTypeName(arg->type()) << ' ' << cppArgRemoved;
-                s << " = " << guessScopeForDefaultValue(func, arg) << ";\n";
-                writeUnusedVariableCast(s, cppArgRemoved);
+                c << INDENT << getFullTypeName(arg->type()) << ' ' << cppArgRemoved;
+                c << " = " << guessScopeForDefaultValue(func, arg) << ";\n";
+                writeUnusedVariableCast(c, cppArgRemoved);
             } else if (!injectCodeCallsFunc && !func->isUserAdded() && !hasConversionRule) {
                 // When an argument is removed from a method signature and no other means of calling
                 // the method are provided (as with code injection) the generator must abort.
@@ -2938,8 +3083,21 @@ void CppGenerator::writeSingleFunctionCall(QTextStream &s,
         QString argName = QLatin1String(CPP_ARG) + QString::number(argPos);
         QString pyArgName = usePyArgs ? pythonArgsAt(argPos) : QLatin1String(PYTHON_ARG);
         QString defaultValue = guessScopeForDefaultValue(func, arg);
-        writeArgumentConversion(s, argType, argName, pyArgName, func->implementingClass(), defaultValue, func->isUserAdded());
+        const bool checkValidity = !compactArgumentParsing() || !usePyArgs
+            || argPos >= 32 || !isWrapperType(argType) || argType->typeEntry()->isCustom();
+        if (!checkValidity)
+            validityMask |= 1u << argPos;
+        writeArgumentConversion(c, argType, argName, pyArgName, func->implementingClass(), defaultValue,
+                                func->isUserAdded(), checkValidity);
+    }
+    c.flush();
+    if (validityMask != 0) {
+        s << INDENT << "if (!Shiboken::checkValidArguments(" << PYTHON_ARGS << ", 0x"
+            << QString::number(validityMask, 16) << "u))\n";
+        Indentation indent(INDENT);
+        s << INDENT << returnStatement(m_currentErrorCode) << Qt::endl;
     }
+    s << conversions;
 
     s << Qt::endl;
 
@@ -3000,6 +3158,21 @@ void CppGenerator::writeCppToPythonFunction(QTextStream &s, const QString &code,
     s << "}\n";
 }
 
+// Returns the buffer format of the element type of a vector container that is
+// exchanged with contiguous Python buffers, or an empty string.
+static QString containerBufferFormat(const AbstractMetaType *containerType)
+{
+    const auto *typeEntry = static_cast<const ContainerTypeEntry *>(containerType->typeEntry());
+    if (typeEntry->containerKind() != ContainerTypeEntry::VectorContainer
+        || containerType->instantiations().size() != 1) {
+        return QString();
+    }
+    const AbstractMetaType *elementType = containerType->instantiations().constFirst();
+    if (elementType->indirections() != 0 || elementType->referenceType() != NoReference)
+        return QString();
+    return elementType->typeEntry()->bufferFormat();
+}
+
 static void replaceCppToPythonVariables(QString &code, const QString &typeName)
 {
     const QString line = QLatin1String("auto &cppInRef = *reinterpret_cast<")
@@ -3029,6 +3202,20 @@ void CppGenerator::writeCppToPythonFunction(QTextStream &s, const AbstractMetaTy
         return;
     }
     QString code = customConversion->nativeToTargetConversion();
+    // Vectors of plain value types are returned as a buffer holding a copy of
+    // the items when the container type opts in.
+    const QString bufferFormat = containerBufferFormat(containerType);
+    if (!bufferFormat.isEmpty()
+        && static_cast<const ContainerTypeEntry *>(containerType->typeEntry())->bufferProtocol()) {
+        const QString itemSize = QLatin1String("Py_ssize_t(sizeof(")
+            + getFullTypeName(containerType->instantiations().constFirst()) + QLatin1String("))");
+        QString bufferCode;
+        QTextStream c(&bufferCode);
+        c << "if (Shiboken::Buffer::isArrayFormat(\"" << bufferFormat << "\", " << itemSize << "))\n"
+          << "    return Shiboken::Buffer::newArray(%in.data(), Py_ssize_t(%in.size()), \""
+          << bufferFormat << "\");\n";
+        code = bufferCode + CodeSnipAbstract::dedent(code);
+    }
     for (int i = 0; i < containerType->instantiations().count(); ++i) {
         AbstractMetaType *type = containerType->instantiations().at(i);
         QString typeName = getFullTypeName(type);
@@ -3165,6 +3352,8 @@ void CppGenerator::writePythonToCppConversionFunctions(QTextStream &s,
     writeIsPythonConvertibleToCppFunction(s, sourceTypeName, targetTypeName, typeCheck);
 }
 
+static inline QString bufferSourceTypeName() { return QStringLiteral("PyBuffer"); }
+
 void CppGenerator::writePythonToCppConversionFunctions(QTextStream &s, const AbstractMetaType *containerType)
 {
     const CustomConversion *customConversion = containerType->typeEntry()->customConversion();
@@ -3215,6 +3404,26 @@ void CppGenerator::writePythonToCppConversionFunctions(QTextStream &s, const Abs
         typeCheck = QString::fromLatin1("%1pyIn)").arg(typeCheck);
     writeIsPythonConvertibleToCppFunction(s, typeName, typeName, typeCheck);
     s << Qt::endl;
+
+    // Python buffer to C++ conversion, copying the items without converting
+    // them one by one.
+    const QString bufferFormat = containerBufferFormat(containerType);
+    if (!bufferFormat.isEmpty()) {
+        const QString itemSize = QLatin1String("sizeof(")
+            + getFullTypeName(containerType->instantiations().constFirst()) + QLatin1Char(')');
+        const QString itemCount = QLatin1String("Shiboken::Buffer::itemCount(pyIn, \"")
+            + bufferFormat + QLatin1String("\", ") + itemSize + QLatin1Char(')');
+        QString bufferCode;
+        QTextStream c(&bufferCode);
+        c << "auto &cppOutRef = *reinterpret_cast<" << cppTypeName << " *>(cppOut);\n"
+          << "const Py_ssize_t count = " << itemCount << ";\n"
+          << "cppOutRef.resize(count);\n"
+          << "Shiboken::Buffer::copyData(pyIn, cppOutRef.data(), count * Py_ssize_t(" << itemSize << "));\n";
+        writePythonToCppFunction(s, bufferCode, bufferSourceTypeName(), typeName);
+        writeIsPythonConvertibleToCppFunction(s, bufferSourceTypeName(), typeName,
+                                              itemCount + QLatin1String(" >= 0"));
+        s << Qt::endl;
+    }
 }
 
 void CppGenerator::writeAddPythonToCppConversion(QTextStream &s, const QString &converterVar, const QString &pythonToCppFunc, const QString &isConvertibleFunc)
@@ -3246,6 +3455,11 @@ void CppGenerator::writeNamedArgumentResolution(QTextStream &s, const AbstractMe
         return;
     }
 
+    if (compactArgumentParsing()) {
+        writeCompactNamedArgumentResolution(s, func, usePyArgs, args);
+        return;
+    }
+
     s << INDENT << "if (kwds) {\n";
     {
         Indentation indent(INDENT);
@@ -3311,6 +3525,96 @@ void CppGenerator::writeNamedArgumentResolution(QTextStream &s, const AbstractMe
     s << INDENT << "}\n";
 }
 
+// Returns the check and type or converter of the Shiboken::KeywordArgument
+// entry equivalent to the check written by writeTypeCheck() for a keyword
+// argument, or an empty string if the check has to be written inline.
+QString CppGenerator::keywordArgumentCheck(const AbstractMetaFunction *func,
+                                           const AbstractMetaArgument *arg)
+{
+    const AbstractMetaType *type = arg->type();
+    const TypeEntry *typeEntry = type->typeEntry();
+    const AbstractMetaTypeCList nestedArrayTypes = type->nestedArrayTypes();
+    if (!func->typeReplaced(arg->argumentIndex() + 1).isEmpty() || typeEntry->isCustom()
+        || (typeEntry->isCppPrimitive() && !isNumber(typeEntry))
+        || (!nestedArrayTypes.isEmpty() && nestedArrayTypes.constLast()->isCppPrimitive())) {
+        return QString();
+    }
+    QString result = QLatin1String("Shiboken::KeywordArgument::");
+    if (isWrapperType(type)) {
+        if (isPointer(type) || isValueTypeWithCopyConstructorOnly(type))
+            result += QLatin1String("PointerCheck");
+        else if (type->referenceType() == LValueReference)
+            result += QLatin1String("ReferenceCheck");
+        else
+            result += QLatin1String("ValueCheck");
+        result += QLatin1String(", reinterpret_cast<SbkObjectType *>(")
+            + cpythonTypeNameExt(type) + QLatin1String("), nullptr");
+    } else {
+        result += QLatin1String("ConverterCheck, nullptr, ") + converterObject(type);
+    }
+    return result;
+}
+
+// Table-driven variant of writeNamedArgumentResolution() leaving the
+// dictionary handling and the type checks to Shiboken::resolveKeywordArguments().
+// The remaining checks are written inline and skip the positional arguments,
+// which the overload decisor has already checked.
+void CppGenerator::writeCompactNamedArgumentResolution(QTextStream &s,
+                                                       const AbstractMetaFunction *func,
+                                                       bool usePyArgs,
+                                                       const AbstractMetaArgumentList &args)
+{
+    const QString errorLabel = cpythonFunctionName(func) + QLatin1String("_TypeError");
+    // PYSIDE-1305: QObject constructors handle extra keyword signals and properties.
+    const bool allowUnknown = func->isConstructor() && func->ownerClass()->isQObject();
+    s << INDENT << "if (kwds) {\n";
+    {
+        Indentation indent(INDENT);
+        AbstractMetaArgumentList inlineChecks;
+        s << INDENT << "static Shiboken::KeywordArgument keywords[] = {\n";
+        for (int i = 0, size = args.size(); i < size; ++i) {
+            const AbstractMetaArgument *arg = args.at(i);
+            const int pyArgIndex = usePyArgs
+                ? arg->argumentIndex() - OverloadData::numberOfRemovedArguments(func, arg->argumentIndex())
+                : 0;
+            QString check = keywordArgumentCheck(func, arg);
+            if (check.isEmpty()) {
+                inlineChecks.append(args.at(i));
+                check = QLatin1String("Shiboken::KeywordArgument::InlineCheck, nullptr, nullptr");
+            }
+            Indentation indent(INDENT);
+            s << INDENT << "{\"" << arg->name() << "\", " << pyArgIndex << ", nullptr, "
+                << check << '}' << (i < size - 1 ? ",\n" : "\n");
+        }
+        s << INDENT << "};\n";
+        s << INDENT << "if (!Shiboken::resolveKeywordArguments(kwds, keywords, " << args.size()
+            << ", " << (usePyArgs ? QLatin1String(PYTHON_ARGS) : QLatin1String("&") + QLatin1String(PYTHON_ARG))
+            << ", " << (usePyArgs ? QLatin1String(PYTHON_TO_CPP_VAR) : QLatin1String("&") + QLatin1String(PYTHON_TO_CPP_VAR))
+            << ", &errInfo, " << (allowUnknown ? "true" : "false") << "))\n";
+        {
+            Indentation indent(INDENT);
+            s << INDENT << "goto " << errorLabel << ";\n";
+        }
+        for (const AbstractMetaArgument *arg : qAsConst(inlineChecks)) {
+            const int pyArgIndex = arg->argumentIndex()
+                - OverloadData::numberOfRemovedArguments(func, arg->argumentIndex());
+            const QString pyArgName = usePyArgs ? pythonArgsAt(pyArgIndex) : QLatin1String(PYTHON_ARG);
+            const QString typeReplaced = func->typeReplaced(arg->argumentIndex() + 1);
+            s << INDENT << "if (" << pyArgName;
+            // Checks storing the converter function are skipped for positional arguments.
+            if (typeReplaced.isEmpty() && !arg->type()->typeEntry()->isCustom())
+                s << " && !" << pythonToCppConverterForArgumentName(pyArgName);
+            s << " && !";
+            writeTypeCheck(s, arg->type(), pyArgName, isNumber(arg->type()->typeEntry()),
+                           typeReplaced);
+            s << ")\n";
+            Indentation indent(INDENT);
+            s << INDENT << "goto " << errorLabel << ";\n";
+        }
+    }
+    s << INDENT << "}\n";
+}
+
 QString CppGenerator::argumentNameFromIndex(const AbstractMetaFunction *func, int argIndex, const AbstractMetaClass **wrappedClass)
 {
     *wrappedClass = nullptr;
@@ -3517,11 +3821,18 @@ void CppGenerator::writeMethodCall(QTextStream &s, const AbstractMetaFunction *f
                 QString className = context.useWrapper()
                     ? context.wrapperName() : owner->qualifiedCppName();
 
+                const bool inlineStorage = !context.forSmartPointer() && useInlineStorage(owner);
                 if (func->functionType() == AbstractMetaFunction::CopyConstructorFunction && maxArgs == 1) {
-                    mc << "new ::" << className << "(*" << CPP_ARG0 << ')';
+                    const QString ctorCall = className + QLatin1String("(*") + QLatin1String(CPP_ARG0) + QLatin1Char(')');
+                    if (inlineStorage)
+                        mc << "inlineStorage ? new (inlineStorage) ::" << ctorCall << " : ";
+                    mc << "new ::" << ctorCall;
                 } else {
                     QString ctorCall = className + QLatin1Char('(') + userArgs.join(QLatin1String(", ")) + QLatin1Char(')');
-                    if (usePySideExtensions() && owner->isQObject()) {
+                    if (inlineStorage) {
+                        mc << "inlineStorage ? new (inlineStorage) ::" << ctorCall
+                            << " : new ::" << ctorCall;
+                    } else if (usePySideExtensions() && owner->isQObject()) {
                         s << INDENT << "void *addr = PySide::nextQObjectMemoryAddr();\n";
                         uva << "if (addr) {\n";
                         {
@@ -3688,6 +3999,10 @@ void CppGenerator::writeMethodCall(QTextStream &s, const AbstractMetaFunction *f
                 if (isObjectTypeUsedAsValueType(func->type())) {
                     s << "Shiboken::Object::newObject(reinterpret_cast<SbkObjectType *>(" << cpythonTypeNameExt(func->type()->typeEntry())
                         << "), " << CPP_RETURN_VAR << ", true, true)";
+                } else if (isValueTypeUsedAsMovableValue(func->type())) {
+                    // The result is not used after the conversion, avoid copying it.
+                    s << "Shiboken::Conversions::moveToPython(reinterpret_cast<SbkObjectType *>("
+                        << cpythonTypeNameExt(func->type()) << "), &" << CPP_RETURN_VAR << ')';
                 } else {
                     writeToPythonConversion(s, func->type(), func->ownerClass(), QLatin1String(CPP_RETURN_VAR));
                 }
@@ -3780,19 +4095,25 @@ void CppGenerator::writeMethodCall(QTextStream &s, const AbstractMetaFunction *f
                 }
             }
 
-            if (refCount.action == ReferenceCount::Add || refCount.action == ReferenceCount::Set)
-                s << INDENT << "Shiboken::Object::keepReference(";
-            else
-                s << INDENT << "Shiboken::Object::removeReference(";
-
-            s << "reinterpret_cast<SbkObject *>(self), \"";
             QString varName = arg_mod.referenceCounts.constFirst().varName;
             if (varName.isEmpty())
                 varName = func->minimalSignature() + QString::number(arg_mod.index);
 
-            s << varName << "\", " << pyArgName
-              << (refCount.action == ReferenceCount::Add ? ", true" : "")
-              << ");\n";
+            // The key is converted to an id once per call site.
+            s << INDENT << "{\n";
+            {
+                Indentation indent(INDENT);
+                s << INDENT << "static const int referenceKeyId = Shiboken::Object::referenceKeyId(\""
+                    << varName << "\");\n";
+                if (refCount.action == ReferenceCount::Add || refCount.action == ReferenceCount::Set)
+                    s << INDENT << "Shiboken::Object::keepReference(";
+                else
+                    s << INDENT << "Shiboken::Object::removeReference(";
+                s << "reinterpret_cast<SbkObject *>(self), referenceKeyId, " << pyArgName
+                  << (refCount.action == ReferenceCount::Add ? ", true" : "")
+                  << ");\n";
+            }
+            s << INDENT << "}\n";
 
             if (arg_mod.index == 0)
                 hasReturnPolicy = true;
@@ -3955,15 +4276,15 @@ void CppGenerator::writeEnumConverterInitialization(QTextStream &s, const TypeEn
             }
         }
 
+        QStringList converterNames(signature);
         while (true) {
-            s << INDENT << "Shiboken::Conversions::registerConverterName(converter, \""
-                << signature << "\");\n";
             const int qualifierPos = signature.indexOf(QLatin1String("::"));
-            if (qualifierPos != -1)
-                signature.remove(0, qualifierPos + 2);
-            else
+            if (qualifierPos == -1)
                 break;
+            signature.remove(0, qualifierPos + 2);
+            converterNames << signature;
         }
+        writeRegisterConverterNames(s, QLatin1String("converter"), converterNames);
     }
     s << INDENT << "}\n";
 
@@ -3989,11 +4310,18 @@ void CppGenerator::writeContainerConverterInitialization(QTextStream &s, const A
     s << ", " << cppToPythonFunctionName(typeName, typeName) << ");\n";
     QString toCpp = pythonToCppFunctionName(typeName, typeName);
     QString isConv = convertibleToCppFunctionName(typeName, typeName);
-    s << INDENT << "Shiboken::Conversions::registerConverterName(" << converter << ", \"" << cppSignature << "\");\n";
+    QStringList converterNames(QString::fromUtf8(cppSignature));
     if (usePySideExtensions() && cppSignature.startsWith("const ") && cppSignature.endsWith("&")) {
         cppSignature.chop(1);
         cppSignature.remove(0, sizeof("const ") / sizeof(char) - 1);
-        s << INDENT << "Shiboken::Conversions::registerConverterName(" << converter << ", \"" << cppSignature << "\");\n";
+        converterNames << QString::fromUtf8(cppSignature);
+    }
+    writeRegisterConverterNames(s, converter, converterNames);
+    // Buffers are checked before the generic sequence conversion.
+    if (!containerBufferFormat(type).isEmpty()) {
+        writeAddPythonToCppConversion(s, converterObject(type),
+                                      pythonToCppFunctionName(bufferSourceTypeName(), typeName),
+                                      convertibleToCppFunctionName(bufferSourceTypeName(), typeName));
     }
     writeAddPythonToCppConversion(s, converterObject(type), toCpp, isConv);
 }
@@ -4297,7 +4625,15 @@ void CppGenerator::writeClassDefinition(QTextStream &s,
     int packageLevel = packageName().count(QLatin1Char('.')) + 1;
     s << "static PyType_Spec " << className << "_spec = {\n";
     s << INDENT << '"' << packageLevel << ':' << computedClassTargetFullName << "\",\n";
-    s << INDENT << "sizeof(SbkObject),\n";
+    const AbstractMetaClass *inlineClass = classContext.forSmartPointer()
+        ? nullptr : inlineStorageClass(metaClass);
+    if (inlineClass) {
+        const QString inlineClassName = inlineClass->qualifiedCppName();
+        s << INDENT << "Shiboken::ObjectType::inlineStorageBasicSize(sizeof(::" << inlineClassName
+            << "), alignof(::" << inlineClassName << ")),\n";
+    } else {
+        s << INDENT << "sizeof(SbkObject),\n";
+    }
     s << INDENT << "0,\n";
     s << INDENT << tp_flags << ",\n";
     s << INDENT << className << "_slots\n";
@@ -4714,8 +5050,9 @@ void CppGenerator::writeSetterFunction(QTextStream &s,
     s << ";\n" << Qt::endl;
 
     if (isPointerToWrapperType(fieldType)) {
-        s << INDENT << "Shiboken::Object::keepReference(reinterpret_cast<SbkObject *>(self), \"";
-        s << metaField->name() << "\", pyIn);\n";
+        s << INDENT << "static const int referenceKeyId = Shiboken::Object::referenceKeyId(\""
+            << metaField->name() << "\");\n";
+        s << INDENT << "Shiboken::Object::keepReference(reinterpret_cast<SbkObject *>(self), referenceKeyId, pyIn);\n";
     }
 
     s << INDENT << "return 0;\n";
@@ -4957,6 +5294,13 @@ void CppGenerator::writeSignatureInfo(QTextStream &s, const AbstractMetaFunction
     }
 }
 
+void CppGenerator::writeImportProfileEvent(QTextStream &s, const char *category,
+                                           const QString &name) const
+{
+    s << INDENT << "Shiboken::ImportProfile::ScopedEvent profile(\"" << category << "\", \""
+        << packageName() << "\", \"" << name << "\");\n";
+}
+
 void CppGenerator::writeEnumsInitialization(QTextStream &s, AbstractMetaEnumList &enums)
 {
     if (enums.isEmpty())
@@ -4965,7 +5309,17 @@ void CppGenerator::writeEnumsInitialization(QTextStream &s, AbstractMetaEnumList
     for (const AbstractMetaEnum *cppEnum : qAsConst(enums)) {
         if (cppEnum->isPrivate())
             continue;
-        writeEnumInitialization(s, cppEnum);
+        if (cppEnum->isAnonymous()) {
+            writeEnumInitialization(s, cppEnum);
+            continue;
+        }
+        s << INDENT << "{\n";
+        {
+            Indentation indent(INDENT);
+            writeImportProfileEvent(s, "enum", getClassTargetFullName(cppEnum, false));
+            writeEnumInitialization(s, cppEnum);
+        }
+        s << INDENT << "}\n";
     }
 }
 
@@ -4978,6 +5332,41 @@ static QString mangleName(QString name)
     return name;
 }
 
+// Sort key of an enum value, wrapping like the conversion to long.
+static qint64 enumSortValue(EnumValue value)
+{
+    return value.type() == EnumValue::Signed
+        ? value.value() : static_cast<qint64>(value.unsignedValue());
+}
+
+void CppGenerator::writeEnumItemTable(QTextStream &s, const AbstractMetaEnum *cppEnum,
+                                      const QString &enumVarTypeObj,
+                                      const QString &enclosingObjectVariable,
+                                      QVector<EnumItemTableEntry> itemTable) const
+{
+    // The items are created on first access. The table is sorted by value
+    // for lookups of the item of a value, keeping the order of aliases.
+    // The index restores the declaration order for "values".
+    std::stable_sort(itemTable.begin(), itemTable.end(),
+                     [](const EnumItemTableEntry &e1, const EnumItemTableEntry &e2) {
+                         return e1.sortValue < e2.sortValue;
+                     });
+    s << INDENT << "static const Shiboken::Enum::EnumItem enumItems[] = {\n";
+    for (const EnumItemTableEntry &entry : qAsConst(itemTable))
+        s << INDENT << "    {\"" << entry.name << "\", " << entry.valueText << ", " << entry.index << "},\n";
+    s << INDENT << "};\n";
+    s << INDENT << "if (!Shiboken::Enum::setEnumItems(" << enumVarTypeObj << ", ";
+    if (cppEnum->enumKind() == EnumClass)
+        s << "nullptr";
+    else
+        s << "reinterpret_cast<PyObject *>(" << enclosingObjectVariable << ')';
+    s << ", enumItems, " << itemTable.size() << "))\n";
+    {
+        Indentation indent(INDENT);
+        s << INDENT << returnStatement(m_currentErrorCode) << Qt::endl;
+    }
+}
+
 void CppGenerator::writeEnumInitialization(QTextStream &s, const AbstractMetaEnum *cppEnum)
 {
     const AbstractMetaClass *enclosingClass = cppEnum->targetLangEnclosingClass();
@@ -5004,12 +5393,12 @@ void CppGenerator::writeEnumInitialization(QTextStream &s, const AbstractMetaEnu
             // We need 'flags->flagsName()' with the full module/class path.
             QString fullPath = getClassTargetFullName(cppEnum);
             fullPath.truncate(fullPath.lastIndexOf(QLatin1Char('.')) + 1);
-            s << INDENT << cpythonTypeNameExt(flags) << " = PySide::QFlags::create(\""
+            s << INDENT << cpythonTypeArrayEntry(flags) << " = PySide::QFlags::create(\""
                 << packageLevel << ':' << fullPath << flags->flagsName() << "\", "
                 << cpythonEnumName(cppEnum) << "_number_slots);\n";
         }
 
-        enumVarTypeObj = cpythonTypeNameExt(enumTypeEntry);
+        enumVarTypeObj = cpythonTypeArrayEntry(enumTypeEntry);
 
         s << INDENT << enumVarTypeObj << " = Shiboken::Enum::";
         s << ((enclosingClass || hasUpperEnclosingClass) ? "createScopedEnum" : "createGlobalEnum");
@@ -5021,10 +5410,10 @@ void CppGenerator::writeEnumInitialization(QTextStream &s, const AbstractMetaEnu
             s << INDENT << '"' << (cppEnum->enclosingClass() ? (cppEnum->enclosingClass()->qualifiedCppName() + QLatin1String("::")) : QString());
             s << cppEnum->name() << '"';
             if (flags)
-                s << ',' << Qt::endl << INDENT << cpythonTypeNameExt(flags);
+                s << ',' << Qt::endl << INDENT << cpythonTypeArrayEntry(flags);
             s << ");\n";
         }
-        s << INDENT << "if (!" << cpythonTypeNameExt(cppEnum->typeEntry()) << ")\n";
+        s << INDENT << "if (!" << cpythonTypeArrayEntry(cppEnum->typeEntry()) << ")\n";
         {
             Indentation indent(INDENT);
             s << INDENT << returnStatement(m_currentErrorCode) << Qt::endl << Qt::endl;
@@ -5032,21 +5421,24 @@ void CppGenerator::writeEnumInitialization(QTextStream &s, const AbstractMetaEnu
     }
 
     const AbstractMetaEnumValueList &enumValues = cppEnum->values();
+    QVector<EnumItemTableEntry> itemTable;
     for (const AbstractMetaEnumValue *enumValue : enumValues) {
         if (enumTypeEntry->isEnumValueRejected(enumValue->name()))
             continue;
 
         QString enumValueText;
+        QString enumValueExpression;
         if (!avoidProtectedHack() || !cppEnum->isProtected()) {
-            enumValueText = QLatin1String("(long) ");
             if (cppEnum->enclosingClass())
-                enumValueText += cppEnum->enclosingClass()->qualifiedCppName() + QLatin1String("::");
+                enumValueExpression += cppEnum->enclosingClass()->qualifiedCppName() + QLatin1String("::");
             // Fully qualify the value which is required for C++ 11 enum classes.
             if (!cppEnum->isAnonymous())
-                enumValueText += cppEnum->name() + QLatin1String("::");
-            enumValueText += enumValue->name();
+                enumValueExpression += cppEnum->name() + QLatin1String("::");
+            enumValueExpression += enumValue->name();
+            enumValueText = QLatin1String("(long) ") + enumValueExpression;
         } else {
-            enumValueText += enumValue->value().toString();
+            enumValueExpression = enumValue->value().toString();
+            enumValueText = enumValueExpression;
         }
 
         switch (cppEnum->enumKind()) {
@@ -5074,28 +5466,20 @@ void CppGenerator::writeEnumInitialization(QTextStream &s, const AbstractMetaEnu
                 }
             }
             break;
-        case CEnum: {
-            s << INDENT << "if (!Shiboken::Enum::";
-            s << ((enclosingClass || hasUpperEnclosingClass) ? "createScopedEnumItem" : "createGlobalEnumItem");
-            s << '(' << enumVarTypeObj << ',' << Qt::endl;
-            Indentation indent(INDENT);
-            s << INDENT << enclosingObjectVariable << ", \"" << mangleName(enumValue->name()) << "\", ";
-            s << enumValueText << "))\n";
-            s << INDENT << returnStatement(m_currentErrorCode) << Qt::endl;
-        }
-            break;
-        case EnumClass: {
-            s << INDENT << "if (!Shiboken::Enum::createScopedEnumItem("
-                << enumVarTypeObj << ',' << Qt::endl;
-            Indentation indent(INDENT);
-            s << INDENT << enumVarTypeObj<< ", \"" << mangleName(enumValue->name()) << "\", "
-               << enumValueText << "))\n"
-               << INDENT << returnStatement(m_currentErrorCode) << Qt::endl;
-        }
+        case CEnum:
+        case EnumClass:
+            // The explicit cast avoids narrowing errors in the brace
+            // initialization, also for the literal values of protected enums.
+            itemTable.append({mangleName(enumValue->name()),
+                              QLatin1String("static_cast<long>(") + enumValueExpression + QLatin1Char(')'),
+                              enumSortValue(enumValue->value()), itemTable.size()});
             break;
         }
     }
 
+    if (!itemTable.isEmpty())
+        writeEnumItemTable(s, cppEnum, enumVarTypeObj, enclosingObjectVariable, itemTable);
+
     writeEnumConverterInitialization(s, cppEnum);
 
     s << INDENT << "// End of '" << cppEnum->name() << "' enum";
@@ -5284,23 +5668,260 @@ QString CppGenerator::getInitFunctionName(const GeneratorContext &context) const
         : getFilteredCppSignatureString(context.preciseType()->cppSignature());
 }
 
-void CppGenerator::writeSignatureStrings(QTextStream &s,
-                                         QTextStream &signatureStream,
-                                         const QString &arrayName,
-                                         const char *comment) const
+// Recompute the overload indexes of signature lines whose distinction vanishes
+// when mapped to Python (see fixup_multilines() in parser.py).
+static QStringList fixupSignatureMultiLines(QTextStream &signatureStream)
 {
-    s << "// The signatures string for the " << comment << ".\n";
-    s << "// Multiple signatures have their index \"n:\" in front.\n";
-    s << "static const char *" << arrayName << "_SignatureStrings[] = {\n";
+    static const QRegularExpression multiRegExp(QStringLiteral("^(\\d+):"));
+    Q_ASSERT(multiRegExp.isValid());
+    QStringList result;
+    QStringList multiLines;
     QString line;
     while (signatureStream.readLineInto(&line)) {
-        // must anything be escaped?
-        if (line.contains(QLatin1Char('"')) || line.contains(QLatin1Char('\\')))
-            s << INDENT << "R\"CPP(" << line << ")CPP\",\n";
+        const QRegularExpressionMatch match = multiRegExp.match(line);
+        if (!match.hasMatch()) {
+            result.append(line);
+            continue;
+        }
+        multiLines.append(line.mid(match.capturedEnd()));
+        if (match.captured(1).toInt() > 0)
+            continue;
+        multiLines.sort();
+        multiLines.removeDuplicates();
+        if (multiLines.size() > 1) {
+            for (int i = 0, size = multiLines.size(); i < size; ++i)
+                result.append(QString::number(size - i - 1) + QLatin1Char(':') + multiLines.at(i));
+        } else {
+            result.append(multiLines.constFirst());
+        }
+        multiLines.clear();
+    }
+    return result;
+}
+
+// Split a signature argument list at the commas outside of brackets and
+// string literals (see build_brace_pattern() in lib/tool.py).
+static QStringList splitSignatureArguments(const QString &arguments)
+{
+    QStringList result;
+    int level = 0;
+    bool quoted = false;
+    int start = 0;
+    for (int i = 0, size = arguments.size(); i < size; ++i) {
+        const QChar c = arguments.at(i);
+        if (quoted) {
+            if (c == QLatin1Char('\\'))
+                ++i;
+            else if (c == QLatin1Char('"'))
+                quoted = false;
+        } else if (c == QLatin1Char('"')) {
+            quoted = true;
+        } else if (c == QLatin1Char('(') || c == QLatin1Char('[')
+                   || c == QLatin1Char('{') || c == QLatin1Char('<')) {
+            ++level;
+        } else if (c == QLatin1Char(')') || c == QLatin1Char(']')
+                   || c == QLatin1Char('}') || c == QLatin1Char('>')) {
+            --level;
+        } else if (c == QLatin1Char(',') && level == 0) {
+            result.append(arguments.mid(start, i - start).trimmed());
+            start = i + 1;
+        }
+    }
+    result.append(arguments.mid(start).trimmed());
+    result.removeAll(QString());
+    return result;
+}
+
+static void writeSignatureString(QTextStream &s, const QString &value)
+{
+    // must anything be escaped?
+    if (value.contains(QLatin1Char('"')) || value.contains(QLatin1Char('\\')))
+        s << "R\"CPP(" << value << ")CPP\"";
+    else
+        s << '"' << value << '"';
+}
+
+// Write the signature lines as a table of type names, arguments and
+// functions (PySideSignatureTable, see signature.h), so that the lines need
+// not be parsed at runtime (see _parse_line() in parser.py).
+void CppGenerator::writeSignatureTable(QTextStream &s,
+                                       QTextStream &signatureStream,
+                                       const QString &arrayName,
+                                       const char *comment) const
+{
+    static const QRegularExpression lineRegExp(
+        QStringLiteral("^((\\d+):)?(\\w+(?:\\.\\w+)*)\\((.*?)\\)(?:->(.*))?$"));
+    Q_ASSERT(lineRegExp.isValid());
+
+    QStringList types;
+    QHash<QString, int> typeIndexes;
+    auto typeIndex = [&types, &typeIndexes](const QString &type) {
+        auto it = typeIndexes.constFind(type);
+        if (it != typeIndexes.cend())
+            return it.value();
+        types.append(type);
+        typeIndexes.insert(type, types.size() - 1);
+        return types.size() - 1;
+    };
+
+    QString arguments;
+    QTextStream argumentStream(&arguments);
+    int argumentCount = 0;
+    QString functions;
+    QTextStream functionStream(&functions);
+    int functionCount = 0;
+    const QString argumentsName = arrayName + QLatin1String("_SignatureArguments");
+
+    const QStringList lines = fixupSignatureMultiLines(signatureStream);
+    for (const QString &line : lines) {
+        const QRegularExpressionMatch match = lineRegExp.match(line);
+        if (!match.hasMatch()) {
+            qCWarning(lcShiboken).noquote().nospace()
+                << "Invalid signature \"" << line << "\" for the " << comment << '.';
+            continue;
+        }
+        const int firstArgument = argumentCount;
+        // PYSIDE-1095: Handle arbitrary default expressions
+        QString argumentList = match.captured(4);
+        argumentList.replace(QLatin1String("->"), QLatin1String(".deref."));
+        const QStringList argumentStrings = splitSignatureArguments(argumentList);
+        for (int a = 0, size = argumentStrings.size(); a < size; ++a) {
+            const QString &argument = argumentStrings.at(a);
+            const int colonPos = argument.indexOf(QLatin1Char(':'));
+            QString name = argument;
+            QString type = argument;
+            if (colonPos >= 0) {
+                name.truncate(colonPos);
+                type.remove(0, colonPos + 1);
+            } else if (a != 0 || argument != QLatin1String("self")) {
+                qCWarning(lcShiboken).noquote().nospace()
+                    << "Invalid argument \"" << argument << "\" in \"" << line << "\".";
+                continue;
+            }
+            const int equalsPos = type.indexOf(QLatin1Char('='));
+            argumentStream << INDENT << '{';
+            writeSignatureString(argumentStream, name);
+            argumentStream << ", " << typeIndex(equalsPos >= 0 ? type.left(equalsPos) : type)
+                << ", ";
+            if (equalsPos >= 0)
+                writeSignatureString(argumentStream, type.mid(equalsPos + 1));
+            else
+                argumentStream << NULL_PTR;
+            argumentStream << "},\n";
+            ++argumentCount;
+        }
+
+        const QString multi = match.captured(2);
+        const bool hasReturnType = match.capturedStart(5) >= 0;
+        functionStream << INDENT << "{\"" << match.captured(3) << "\", "
+            << (multi.isEmpty() ? QLatin1String("-1") : multi) << ", "
+            << (hasReturnType ? typeIndex(match.captured(5)) : -1) << ", "
+            << (argumentCount - firstArgument) << ", ";
+        if (argumentCount > firstArgument)
+            functionStream << argumentsName << " + " << firstArgument;
         else
-            s << INDENT << '"' << line << "\",\n";
+            functionStream << NULL_PTR;
+        functionStream << "},\n";
+        ++functionCount;
     }
-    s << INDENT << NULL_PTR << "}; // Sentinel\n\n";
+
+    s << "// The signatures of the " << comment << ", split into a table.\n";
+    s << "// Multiple signatures have an overload index counting down to 0.\n";
+    const QString typesName = arrayName + QLatin1String("_SignatureTypes");
+    if (!types.isEmpty()) {
+        s << "static const char *const " << typesName << "[] = {\n";
+        for (const QString &type : qAsConst(types)) {
+            s << INDENT;
+            writeSignatureString(s, type);
+            s << ",\n";
+        }
+        s << "};\n\n";
+    }
+    if (argumentCount > 0)
+        s << "static const PySideSignatureArgument " << argumentsName << "[] = {\n" << arguments << "};\n\n";
+    const QString functionsName = arrayName + QLatin1String("_SignatureFunctions");
+    if (functionCount > 0)
+        s << "static const PySideSignatureFunction " << functionsName << "[] = {\n" << functions << "};\n\n";
+    s << "static const PySideSignatureTable " << arrayName << "_SignatureTable = {\n"
+        << INDENT << (types.isEmpty() ? QLatin1String(NULL_PTR) : typesName)
+        << ", " << types.size() << ",\n"
+        << INDENT << (functionCount > 0 ? functionsName : QLatin1String(NULL_PTR))
+        << ", " << functionCount << "\n};\n\n";
+}
+
+// Returns whether injected code may store references between wrappers.
+static bool storesPythonReferences(const CodeSnipList &snips)
+{
+    for (const CodeSnip &snip : snips) {
+        const QString code = snip.code();
+        if (code.contains(QLatin1String("keepReference"))
+            || code.contains(QLatin1String("setParent"))) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Returns the type of the object at an argument modification index.
+static const TypeEntry *modifiedObjectType(const AbstractMetaFunction *func, int index)
+{
+    if (index == ArgumentOwner::ThisIndex)
+        return func->ownerClass() ? func->ownerClass()->typeEntry() : nullptr;
+    if (index == ArgumentOwner::ReturnIndex)
+        return func->type() ? func->type()->typeEntry() : nullptr;
+    const AbstractMetaArgumentList &arguments = func->arguments();
+    return index > 0 && index <= arguments.size()
+        ? arguments.at(index - 1)->type()->typeEntry() : nullptr;
+}
+
+// Returns whether a function makes wrappers of \p type hold references to
+// other Python objects, by reference count or ownership modifications of
+// either side or by injected code.
+static bool holdsPythonReferences(const AbstractMetaFunction *func,
+                                  const AbstractMetaClass *implementor,
+                                  const TypeEntry *type)
+{
+    const FunctionModificationList &mods = func->modifications(implementor);
+    for (const FunctionModification &mod : mods) {
+        for (const ArgumentModification &argMod : mod.argument_mods) {
+            // Reference counts are kept by the wrapper of "this".
+            if (!argMod.referenceCounts.isEmpty()
+                && modifiedObjectType(func, ArgumentOwner::ThisIndex) == type) {
+                return true;
+            }
+            if (argMod.owner.index != ArgumentOwner::InvalidIndex
+                && (modifiedObjectType(func, argMod.owner.index) == type
+                    || modifiedObjectType(func, argMod.index) == type)) {
+                return true;
+            }
+        }
+    }
+    return func->ownerClass() != nullptr && func->ownerClass()->typeEntry() == type
+        && storesPythonReferences(func->injectedCodeSnips());
+}
+
+// Returns whether the wrappers of a class may hold references to other
+// Python objects. All classes and global functions are checked since
+// modifications of other classes may make it a parent.
+static bool holdsPythonReferences(const AbstractMetaClass *metaClass,
+                                  const AbstractMetaClassList &classes,
+                                  const AbstractMetaFunctionList &globalFunctions)
+{
+    const TypeEntry *type = metaClass->typeEntry();
+    if (storesPythonReferences(type->codeSnips()))
+        return true;
+    for (const AbstractMetaClass *cls : classes) {
+        const AbstractMetaFunctionList &functions = cls->functions();
+        for (const AbstractMetaFunction *func : functions) {
+            if (holdsPythonReferences(func, cls, type))
+                return true;
+        }
+    }
+    for (const AbstractMetaFunction *func : globalFunctions) {
+        if (holdsPythonReferences(func, nullptr, type))
+            return true;
+    }
+    return false;
 }
 
 void CppGenerator::writeClassRegister(QTextStream &s,
@@ -5317,10 +5938,15 @@ void CppGenerator::writeClassRegister(QTextStream &s,
     QString initFunctionName = getInitFunctionName(classContext);
 
     // PYSIDE-510: Create a signatures string for the introspection feature.
-    writeSignatureStrings(s, signatureStream, initFunctionName, "functions");
+    writeSignatureTable(s, signatureStream, initFunctionName, "functions");
     s << "void init_" << initFunctionName;
     s << "(PyObject *" << enclosingObjectVariable << ")\n{\n";
 
+    const QString profileName = classContext.forSmartPointer()
+        ? getClassTargetFullName(classContext.preciseType(), false)
+        : getClassTargetFullName(metaClass, false);
+    writeImportProfileEvent(s, "class", profileName);
+
     // Multiple inheritance
     QString pyTypeBasesVariable = chopType(pyTypeName) + QLatin1String("_Type_bases");
     const AbstractMetaClassList baseClasses = getBaseClasses(metaClass);
@@ -5414,6 +6040,15 @@ void CppGenerator::writeClassRegister(QTextStream &s,
             wrapperFlags.append(QByteArrayLiteral("Shiboken::ObjectType::WrapperFlags::InnerClass"));
         if (metaClass->deleteInMainThread())
             wrapperFlags.append(QByteArrayLiteral("Shiboken::ObjectType::WrapperFlags::DeleteInMainThread"));
+        if (!classTypeEntry->gcTracking() && classTypeEntry->isValue()) {
+            if (holdsPythonReferences(metaClass, classes(), globalFunctions())) {
+                qCWarning(lcShiboken).noquote().nospace()
+                    << "gc-tracking=\"no\" is ignored for " << metaClass->qualifiedCppName()
+                    << " since its wrappers may hold references to other objects.";
+            } else {
+                wrapperFlags.append(QByteArrayLiteral("Shiboken::ObjectType::WrapperFlags::NoGcTracking"));
+            }
+        }
         if (wrapperFlags.isEmpty())
             s << INDENT << '0';
         else
@@ -5422,23 +6057,48 @@ void CppGenerator::writeClassRegister(QTextStream &s,
     s << INDENT << ");\n";
     s << INDENT << Qt::endl;
 
+    if (!classContext.forSmartPointer() && useInlineStorage(metaClass)) {
+        const QString className = metaClass->qualifiedCppName();
+        s << INDENT << "Shiboken::ObjectType::setInlineStorage(" << typePtr << ", sizeof(::"
+            << className << "), alignof(::" << className << "),\n"
+            << INDENT << "    &Shiboken::callCppInPlaceDestructor< ::" << className << " >);\n";
+    }
+    if (classTypeEntry->freeListSize() > 0) {
+        s << INDENT << "Shiboken::ObjectType::setFreeListSize(" << typePtr << ", "
+            << classTypeEntry->freeListSize() << ");\n";
+    }
+
     s << INDENT << "auto pyType = reinterpret_cast<PyTypeObject *>(" << typePtr << ");\n";
-    s << INDENT << "InitSignatureStrings(pyType, " << initFunctionName << "_SignatureStrings);\n";
+    s << INDENT << "{\n";
+    {
+        Indentation indent(INDENT);
+        writeImportProfileEvent(s, "signatures", profileName);
+        s << INDENT << "InitSignatureTable(pyType, &" << initFunctionName << "_SignatureTable);\n";
+    }
+    s << INDENT << "}\n";
 
     if (usePySideExtensions())
         s << INDENT << "SbkObjectType_SetPropertyStrings(reinterpret_cast<PyTypeObject *>(" << typePtr << "), "
                     << chopType(pyTypeName) << "_PropertyStrings);\n";
 
     if (!classContext.forSmartPointer())
-        s << INDENT << cpythonTypeNameExt(classTypeEntry) << Qt::endl;
+        s << INDENT << cpythonTypeArrayEntry(classTypeEntry) << Qt::endl;
     else
-        s << INDENT << cpythonTypeNameExt(classContext.preciseType()) << Qt::endl;
+        s << INDENT << cpythonTypeArrayEntry(classContext.preciseType()) << Qt::endl;
     s << INDENT << "    = reinterpret_cast<PyTypeObject *>(" << pyTypeName << ");\n";
     s << Qt::endl;
 
     // Register conversions for the type.
-    writeConverterRegister(s, metaClass, classContext);
-    s << Qt::endl;
+    if (!metaClass->isNamespace()) {
+        s << INDENT << "{\n";
+        {
+            Indentation indent(INDENT);
+            writeImportProfileEvent(s, "converters", profileName);
+            writeConverterRegister(s, metaClass, classContext);
+        }
+        s << INDENT << "}\n";
+        s << Qt::endl;
+    }
 
     // class inject-code target/beginning
     if (!classTypeEntry->codeSnips().isEmpty()) {
@@ -5809,7 +6469,12 @@ void CppGenerator::writeGetattroFunction(QTextStream &s, AttroCheck attroCheck,
         s << INDENT << "}\n";
     }
 
-    s << INDENT << "return " << getattrFunc << ";\n}\n\n";
+    s << INDENT << "if (PyObject *attr = " << getattrFunc << ")\n";
+    {
+        Indentation indent(INDENT);
+        s << INDENT << "return attr;\n";
+    }
+    s << INDENT << "return Shiboken::Enum::getPendingItem(Py_TYPE(self), name);\n}\n\n";
 }
 
 void CppGenerator::writeSmartPointerGetattroFunction(QTextStream &s, const GeneratorContext &context)
@@ -5877,6 +6542,66 @@ void CppGenerator::writeInitFunc(QTextStream &declStr, QTextStream &callStr,
     }
 }
 
+// Nested types can only be created on demand when their enclosing types are
+// generated into the same module.
+static bool canInitializeLazily(const TypeEntry *entry, const QString &package)
+{
+    for ( ; entry && entry->type() != TypeEntry::TypeSystemType;
+         entry = entry->targetLangEnclosingEntry()) {
+        if (!entry->generateCode() || entry->targetLangPackage() != package)
+            return false;
+    }
+    return true;
+}
+
+// Write the declaration of the init function and the entries of the table of
+// lazily created types for a class and its enums for the module init function.
+void CppGenerator::writeLazyTypeEntries(QTextStream &declStr, QTextStream &entryStr,
+                                        const Indentor &indent,
+                                        const AbstractMetaClass *metaClass)
+{
+    const TypeEntry *typeEntry = metaClass->typeEntry();
+    const TypeEntry *enclosingEntry = typeEntry->targetLangEnclosingEntry();
+    const bool hasParent =
+        enclosingEntry && enclosingEntry->type() != TypeEntry::TypeSystemType;
+    const QString initFunctionName = getSimpleClassInitFunctionName(metaClass);
+    declStr << "void init_" << initFunctionName << "(PyObject *"
+        << (hasParent ? "enclosingClass" : "module") << ");\n";
+
+    const QString indexName = getTypeIndexVariableName(typeEntry);
+    const QString qualifiedCppName = typeEntry->qualifiedCppName();
+    entryStr << indent << "lazyTypes[" << indexName << "] = {";
+    if (hasParent)
+        entryStr << "nullptr";
+    else
+        entryStr << '"' << metaClass->name() << '"';
+    entryStr << ", \"" << qualifiedCppName << "\", ";
+    if (metaClass->isNamespace())
+        entryStr << "nullptr";
+    else
+        entryStr << "typeid(::" << qualifiedCppName << ").name()";
+    entryStr << ", init_" << initFunctionName << ", "
+        << (hasParent ? getTypeIndexVariableName(enclosingEntry) : QLatin1String("-1"))
+        << "};\n";
+
+    // Enums and flags are created by the init function of the class.
+    AbstractMetaEnumList classEnums = metaClass->enums();
+    metaClass->getEnumsFromInvisibleNamespacesToBeGenerated(&classEnums);
+    for (const AbstractMetaEnum *cppEnum : qAsConst(classEnums)) {
+        if (cppEnum->isPrivate() || cppEnum->isAnonymous())
+            continue;
+        const EnumTypeEntry *enumTypeEntry = cppEnum->typeEntry();
+        entryStr << indent << "lazyTypes[" << getTypeIndexVariableName(enumTypeEntry)
+            << "] = {nullptr, \"" << enumTypeEntry->qualifiedCppName()
+            << "\", nullptr, nullptr, " << indexName << "};\n";
+        if (const FlagsTypeEntry *flags = enumTypeEntry->flags()) {
+            entryStr << indent << "lazyTypes[" << getTypeIndexVariableName(flags)
+                << "] = {nullptr, \"" << flags->originalName()
+                << "\", nullptr, nullptr, " << indexName << "};\n";
+        }
+    }
+}
+
 bool CppGenerator::finishGeneration()
 {
     //Generate CPython wrapper file
@@ -5930,8 +6655,14 @@ bool CppGenerator::finishGeneration()
     }
     const AbstractMetaClassList lst = classesTopologicalSorted(additionalDependencies);
 
+    QString lazyTypeEntries;
+    QTextStream s_lazyTypeEntries(&lazyTypeEntries);
     for (const AbstractMetaClass *cls : lst){
-        if (shouldGenerate(cls)) {
+        if (!shouldGenerate(cls))
+            continue;
+        if (lazyTypeInitialization() && canInitializeLazily(cls->typeEntry(), packageName())) {
+            writeLazyTypeEntries(s_classInitDecl, s_lazyTypeEntries, INDENT, cls);
+        } else {
             writeInitFunc(s_classInitDecl, s_classPythonDefines, INDENT,
                           getSimpleClassInitFunctionName(cls),
                           cls->typeEntry()->targetLangEnclosingEntry());
@@ -5963,6 +6694,8 @@ bool CppGenerator::finishGeneration()
     s << "#include <shiboken.h>\n";
     s << "#include <algorithm>\n";
     s << "#include <signature.h>\n";
+    if (lazyTypeInitialization())
+        s << "#include <typeinfo>\n";
     if (usePySideExtensions()) {
         s << includeQDebug;
         s << "#include <pyside.h>\n";
@@ -6003,6 +6736,8 @@ bool CppGenerator::finishGeneration()
     s << "// Current module's converter array.\n";
     s << "SbkConverter **" << convertersVariableName() << " = nullptr;\n";
 
+    writeMethodNamesTable(s);
+
     const CodeSnipList snips = moduleEntry->codeSnips();
 
     // module inject-code native/beginning
@@ -6132,9 +6867,11 @@ bool CppGenerator::finishGeneration()
     s << "#endif\n\n";
 
     // PYSIDE-510: Create a signatures string for the introspection feature.
-    writeSignatureStrings(s, signatureStream, moduleName(), "global functions");
+    writeSignatureTable(s, signatureStream, moduleName(), "global functions");
 
     s << "SBK_MODULE_INIT_FUNCTION_BEGIN(" << moduleName() << ")\n";
+    writeImportProfileEvent(s, "module", packageName());
+    s << Qt::endl;
 
     ErrorCode errorCode(QLatin1String("SBK_MODULE_INIT_ERROR"));
     // module inject-code target/beginning
@@ -6160,6 +6897,12 @@ bool CppGenerator::finishGeneration()
         s << INDENT << cppApiVariableName() << " = cppApi;\n\n";
     }
 
+    if (!m_methodNames.isEmpty()) {
+        s << INDENT << "// Intern the virtual method names.\n";
+        s << INDENT << "Shiboken::String::createStaticStrings(methodNameStrings, "
+            << methodNamesVariableName() << ");\n\n";
+    }
+
     s << INDENT << "// Create an array of primitive type converters for the current module.\n";
     s << INDENT << "static SbkConverter *sbkConverters[SBK_" << moduleName() << "_CONVERTERS_IDX_COUNT" << "];\n";
     s << INDENT << convertersVariableName() << " = sbkConverters;\n\n";
@@ -6177,40 +6920,56 @@ bool CppGenerator::finishGeneration()
     //s << INDENT << "// Initialize converters for primitive types.\n";
     //s << INDENT << "initConverters();\n\n";
 
+    if (!lazyTypeEntries.isEmpty()) {
+        s << INDENT << "// Register the classes to be created on first access\n";
+        s << INDENT << "static Shiboken::Module::LazyType lazyTypes[SBK_"
+            << moduleName() << "_IDX_COUNT];\n";
+        s << lazyTypeEntries;
+        s << INDENT << "Shiboken::Module::registerLazyTypes(module, cppApi, lazyTypes, SBK_"
+            << moduleName() << "_IDX_COUNT);\n\n";
+    }
+
     s << INDENT << "// Initialize classes in the type system\n";
     s << classPythonDefines;
 
-    if (!typeConversions.isEmpty()) {
-        s << Qt::endl;
-        for (const CustomConversion *conversion : typeConversions) {
-            writePrimitiveConverterInitialization(s, conversion);
+    s << Qt::endl << INDENT << "{\n";
+    {
+        Indentation indent(INDENT);
+        writeImportProfileEvent(s, "converters", packageName());
+
+        if (!typeConversions.isEmpty()) {
             s << Qt::endl;
+            for (const CustomConversion *conversion : typeConversions) {
+                writePrimitiveConverterInitialization(s, conversion);
+                s << Qt::endl;
+            }
         }
-    }
 
-    if (!containers.isEmpty()) {
-        s << Qt::endl;
-        for (const AbstractMetaType *container : containers) {
-            writeContainerConverterInitialization(s, container);
+        if (!containers.isEmpty()) {
             s << Qt::endl;
+            for (const AbstractMetaType *container : containers) {
+                writeContainerConverterInitialization(s, container);
+                s << Qt::endl;
+            }
         }
-    }
 
-    if (!smartPointersList.isEmpty()) {
-        s << Qt::endl;
-        for (const AbstractMetaType *smartPointer : smartPointersList) {
-            writeSmartPointerConverterInitialization(s, smartPointer);
+        if (!smartPointersList.isEmpty()) {
             s << Qt::endl;
+            for (const AbstractMetaType *smartPointer : smartPointersList) {
+                writeSmartPointerConverterInitialization(s, smartPointer);
+                s << Qt::endl;
+            }
         }
-    }
 
-    if (!extendedConverters.isEmpty()) {
-        s << Qt::endl;
-        for (ExtendedConverterData::const_iterator it = extendedConverters.cbegin(), end = extendedConverters.cend(); it != end; ++it) {
-            writeExtendedConverterInitialization(s, it.key(), it.value());
+        if (!extendedConverters.isEmpty()) {
             s << Qt::endl;
+            for (ExtendedConverterData::const_iterator it = extendedConverters.cbegin(), end = extendedConverters.cend(); it != end; ++it) {
+                writeExtendedConverterInitialization(s, it.key(), it.value());
+                s << Qt::endl;
+            }
         }
     }
+    s << INDENT << "}\n\n";
 
     writeEnumsInitialization(s, globalEnums);
 
@@ -6224,11 +6983,12 @@ bool CppGenerator::finishGeneration()
             continue;
         QString converter = converterObject(referencedType);
         QStringList cppSignature = pte->qualifiedCppName().split(QLatin1String("::"), Qt::SkipEmptyParts);
+        QStringList converterNames;
         while (!cppSignature.isEmpty()) {
-            QString signature = cppSignature.join(QLatin1String("::"));
-            s << INDENT << "Shiboken::Conversions::registerConverterName(" << converter << ", \"" << signature << "\");\n";
+            converterNames << cppSignature.join(QLatin1String("::"));
             cppSignature.removeFirst();
         }
+        writeRegisterConverterNames(s, converter, converterNames);
     }
 
     s << Qt::endl;
@@ -6259,9 +7019,18 @@ bool CppGenerator::finishGeneration()
         s << INDENT << "PySide::registerCleanupFunction(cleanTypesAttributes);\n\n";
     }
 
+    if (!lazyTypeEntries.isEmpty())
+        s << INDENT << "Shiboken::Module::finishLazyTypes(module);\n";
+
     // finish the rest of __signature__ initialization.
-    s << INDENT << "FinishSignatureInitialization(module, " << moduleName()
-        << "_SignatureStrings);\n";
+    s << INDENT << "{\n";
+    {
+        Indentation indent(INDENT);
+        writeImportProfileEvent(s, "signatures", packageName());
+        s << INDENT << "FinishSignatureTableInitialization(module, &" << moduleName()
+            << "_SignatureTable);\n";
+    }
+    s << INDENT << "}\n";
 
     s << Qt::endl;
     s << "SBK_MODULE_INIT_FUNCTION_END\n";
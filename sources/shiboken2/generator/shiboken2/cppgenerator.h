@@ -53,6 +53,8 @@ private:
     void writeInitFunc(QTextStream &declStr, QTextStream &callStr,
                        const Indentor &indent, const QString &initFunctionName,
                        const TypeEntry *enclosingEntry = nullptr);
+    void writeLazyTypeEntries(QTextStream &declStr, QTextStream &entryStr,
+                              const Indentor &indent, const AbstractMetaClass *metaClass);
     void writeCacheResetNative(QTextStream &s, const GeneratorContext &classContext);
     void writeConstructorNative(QTextStream &s, const GeneratorContext &classContext,
                                 const AbstractMetaFunction *func);
@@ -60,6 +62,8 @@ private:
 
     QString getVirtualFunctionReturnTypeName(const AbstractMetaFunction *func);
     void writeVirtualMethodNative(QTextStream &s, const AbstractMetaFunction *func, int cacheIndex);
+    int methodNameIndex(const QString &name);
+    void writeMethodNamesTable(QTextStream &s) const;
     void writeVirtualMethodCppCall(QTextStream &s, const AbstractMetaFunction *func,
                                    const QString &funcName, const CodeSnipList &snips,
                                    const AbstractMetaArgument *lastArg, const TypeEntry *retType,
@@ -75,6 +79,8 @@ private:
     void writeConverterFunctions(QTextStream &s, const AbstractMetaClass *metaClass,
                                  const GeneratorContext &classContext);
     void writeCustomConverterFunctions(QTextStream &s, const CustomConversion *customConversion);
+    void writeRegisterConverterNames(QTextStream &s, const QString &converter,
+                                     const QStringList &names);
     void writeConverterRegister(QTextStream &s, const AbstractMetaClass *metaClass,
                                 const GeneratorContext &classContext);
     void writeCustomConverterRegister(QTextStream &s, const CustomConversion *customConversion, const QString &converterVar);
@@ -137,12 +143,14 @@ private:
      *   \param context              the current meta class
      *   \param defaultValue         an optional default value to be used instead of the conversion result
      *   \param castArgumentAsUnused if true the converted argument is cast as unused to avoid compiler warnings
+     *   \param checkValidity        if false the validity check of wrapper arguments is left to the caller
      */
     void writeArgumentConversion(QTextStream &s, const AbstractMetaType *argType,
                                  const QString &argName, const QString &pyArgName,
                                  const AbstractMetaClass *context = nullptr,
                                  const QString &defaultValue = QString(),
-                                 bool castArgumentAsUnused = false);
+                                 bool castArgumentAsUnused = false,
+                                 bool checkValidity = true);
 
     /**
      *  Returns the AbstractMetaType for a function argument.
@@ -249,6 +257,11 @@ private:
 
     void writeNamedArgumentResolution(QTextStream &s, const AbstractMetaFunction *func,
                                       bool usePyArgs, const OverloadData &overloadData);
+    void writeCompactNamedArgumentResolution(QTextStream &s, const AbstractMetaFunction *func,
+                                             bool usePyArgs,
+                                             const AbstractMetaArgumentList &args);
+    QString keywordArgumentCheck(const AbstractMetaFunction *func,
+                                 const AbstractMetaArgument *arg);
 
     /// Returns a string containing the name of an argument for the given function and argument index.
     QString argumentNameFromIndex(const AbstractMetaFunction *func, int argIndex, const AbstractMetaClass **wrappedClass);
@@ -258,9 +271,9 @@ private:
     QString getInitFunctionName(const GeneratorContext &context) const;
     QString getSimpleClassInitFunctionName(const AbstractMetaClass *metaClass) const;
 
-    void writeSignatureStrings(QTextStream &s, QTextStream &signatureStream,
-                               const QString &arrayName,
-                               const char *comment) const;
+    void writeSignatureTable(QTextStream &s, QTextStream &signatureStream,
+                             const QString &arrayName,
+                             const char *comment) const;
     void writeClassRegister(QTextStream &s,
                             const AbstractMetaClass *metaClass,
                             const GeneratorContext &classContext,
@@ -310,8 +323,20 @@ private:
 
     void writeRichCompareFunction(QTextStream &s, const GeneratorContext &context);
 
+    void writeImportProfileEvent(QTextStream &s, const char *category, const QString &name) const;
     void writeEnumsInitialization(QTextStream &s, AbstractMetaEnumList &enums);
     void writeEnumInitialization(QTextStream &s, const AbstractMetaEnum *metaEnum);
+    struct EnumItemTableEntry
+    {
+        QString name;
+        QString valueText;
+        qint64 sortValue;
+        int index;          // declaration order
+    };
+    void writeEnumItemTable(QTextStream &s, const AbstractMetaEnum *cppEnum,
+                            const QString &enumVarTypeObj,
+                            const QString &enclosingObjectVariable,
+                            QVector<EnumItemTableEntry> itemTable) const;
 
     void writeSignalInitialization(QTextStream &s, const AbstractMetaClass *metaClass);
 
@@ -381,6 +406,10 @@ private:
 
     const AbstractMetaType *findSmartPointerInstantiation(const TypeEntry *entry) const;
 
+    // Names of the virtual methods followed by their snake_case forms.
+    QStringList m_methodNames;
+    QHash<QString, int> m_methodNameIndexes;
+
     // Number protocol structure members names.
     static QHash<QString, QString> m_nbFuncs;
 
@@ -66,6 +66,16 @@ void HeaderGenerator::writeCopyCtor(QTextStream &s, const AbstractMetaClass *met
     s << INDENT << "}\n\n";
 }
 
+// Used by the C++ to Python move conversion of value types.
+void HeaderGenerator::writeMoveCtor(QTextStream &s, const AbstractMetaClass *metaClass) const
+{
+    s << INDENT <<  wrapperName(metaClass) << '(' << metaClass->qualifiedCppName() << " &&self)";
+    s << " : " << metaClass->qualifiedCppName() << "(std::move(self))\n";
+    s << INDENT << "{\n";
+    s << INDENT << "    resetPyMethodCache();\n";
+    s << INDENT << "}\n\n";
+}
+
 void HeaderGenerator::writeProtectedFieldAccessors(QTextStream &s, const AbstractMetaField *field) const
 {
     AbstractMetaType *metaType = field->type();
@@ -121,6 +131,8 @@ void HeaderGenerator::generateClass(QTextStream &s, const GeneratorContext &clas
     //Includes
     auto typeEntry = metaClass->typeEntry();
     s << typeEntry->include() << '\n';
+    if (classContext.useWrapper())
+        s << "#include <utility>\n";
     if (classContext.useWrapper() && !typeEntry->extraIncludes().isEmpty()) {
         s << "\n// Extra includes\n";
         for (const Include &inc : typeEntry->extraIncludes())
@@ -155,6 +167,8 @@ void HeaderGenerator::generateClass(QTextStream &s, const GeneratorContext &clas
         }
         if (!maxOverrides)
             maxOverrides = 1;
+        if (hasMoveToPythonConversion(metaClass))
+            writeMoveCtor(s, metaClass);
 
         if (avoidProtectedHack() && metaClass->hasProtectedFields()) {
             const AbstractMetaFieldList &fields = metaClass->fields();
@@ -547,6 +561,8 @@ bool HeaderGenerator::finishGeneration()
 
     s << "#include <sbkpython.h>\n";
     s << "#include <sbkconverter.h>\n";
+    if (lazyTypeInitialization())
+        s << "#include <sbkmodule.h>\n";
 
     QStringList requiredTargetImports = TypeDatabase::instance()->requiredTargetImports();
     if (!requiredTargetImports.isEmpty()) {
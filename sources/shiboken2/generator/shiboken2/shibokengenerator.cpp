@@ -50,6 +50,8 @@ static const char ENABLE_PYSIDE_EXTENSIONS[] = "enable-pyside-extensions";
 static const char DISABLE_VERBOSE_ERROR_MESSAGES[] = "disable-verbose-error-messages";
 static const char USE_ISNULL_AS_NB_NONZERO[] = "use-isnull-as-nb_nonzero";
 static const char WRAPPER_DIAGNOSTICS[] = "wrapper-diagnostics";
+static const char COMPACT_ARGUMENT_PARSING[] = "compact-argument-parsing";
+static const char LAZY_TYPE_INITIALIZATION[] = "lazy-type-initialization";
 
 const char *CPP_ARG = "cppArg";
 const char *CPP_ARG_REMOVED = "removed_cppArg";
@@ -325,6 +327,27 @@ bool ShibokenGenerator::shouldGenerateCppWrapper(const AbstractMetaClass *metaCl
     return result;
 }
 
+bool ShibokenGenerator::useInlineStorage(const AbstractMetaClass *metaClass) const
+{
+    const ComplexTypeEntry *typeEntry = metaClass->typeEntry();
+    return typeEntry->isValue() && typeEntry->inlineStorage()
+        && metaClass->baseClassNames().size() <= 1
+        && !metaClass->deleteInMainThread()
+        && !metaClass->hasPrivateDestructor() && !metaClass->hasProtectedDestructor()
+        && !shouldGenerateCppWrapper(metaClass);
+}
+
+const AbstractMetaClass *ShibokenGenerator::inlineStorageClass(const AbstractMetaClass *metaClass) const
+{
+    if (useInlineStorage(metaClass))
+        return metaClass;
+    for (const AbstractMetaClass *base : metaClass->baseClasses()) {
+        if (const AbstractMetaClass *result = inlineStorageClass(base))
+            return result;
+    }
+    return nullptr;
+}
+
 bool ShibokenGenerator::shouldWriteVirtualMethodNative(const AbstractMetaFunction *func)
 {
     // PYSIDE-803: Extracted this because it is used multiple times.
@@ -846,6 +869,15 @@ QString ShibokenGenerator::cpythonTypeName(const TypeEntry *type)
 }
 
 QString ShibokenGenerator::cpythonTypeNameExt(const TypeEntry *type) const
+{
+    if (!m_lazyTypeInitialization)
+        return cpythonTypeArrayEntry(type);
+    return QLatin1String("Shiboken::Module::getType(")
+        + cppApiVariableName(type->targetLangPackage()) + QLatin1String(", ")
+        + getTypeIndexVariableName(type) + QLatin1Char(')');
+}
+
+QString ShibokenGenerator::cpythonTypeArrayEntry(const TypeEntry *type) const
 {
     return cppApiVariableName(type->targetLangPackage()) + QLatin1Char('[')
             + getTypeIndexVariableName(type) + QLatin1Char(']');
@@ -899,6 +931,15 @@ QString ShibokenGenerator::converterObject(const TypeEntry *type)
 }
 
 QString ShibokenGenerator::cpythonTypeNameExt(const AbstractMetaType *type) const
+{
+    if (!m_lazyTypeInitialization)
+        return cpythonTypeArrayEntry(type);
+    return QLatin1String("Shiboken::Module::getType(")
+        + cppApiVariableName(type->typeEntry()->targetLangPackage()) + QLatin1String(", ")
+        + getTypeIndexVariableName(type) + QLatin1Char(')');
+}
+
+QString ShibokenGenerator::cpythonTypeArrayEntry(const AbstractMetaType *type) const
 {
     return cppApiVariableName(type->typeEntry()->targetLangPackage()) + QLatin1Char('[')
            + getTypeIndexVariableName(type) + QLatin1Char(']');
@@ -1061,6 +1102,17 @@ bool ShibokenGenerator::isObjectTypeUsedAsValueType(const AbstractMetaType *type
     return type->typeEntry()->isObject() && type->referenceType() == NoReference && type->indirections() == 0;
 }
 
+bool ShibokenGenerator::isValueTypeUsedAsMovableValue(const AbstractMetaType *type)
+{
+    return type->typeEntry()->isValue() && isWrapperType(type) && !type->isConstant()
+        && type->referenceType() == NoReference && type->indirections() == 0;
+}
+
+bool ShibokenGenerator::hasMoveToPythonConversion(const AbstractMetaClass *metaClass)
+{
+    return metaClass->typeEntry()->isValue() && metaClass->hasPublicMoveConstructor();
+}
+
 bool ShibokenGenerator::isValueTypeWithCopyConstructorOnly(const AbstractMetaClass *metaClass)
 {
     if (!metaClass || !metaClass->typeEntry()->isValue())
@@ -2570,11 +2622,17 @@ Generator::OptionDescriptions ShibokenGenerator::options() const
     return OptionDescriptions()
         << qMakePair(QLatin1String(AVOID_PROTECTED_HACK),
                      QLatin1String("Avoid the use of the '#define protected public' hack."))
+        << qMakePair(QLatin1String(COMPACT_ARGUMENT_PARSING),
+                     QLatin1String("Use helper functions of libshiboken for checking keyword arguments,\n"
+                                   "wrapper validity and argument errors to reduce the size of the bindings."))
         << qMakePair(QLatin1String(DISABLE_VERBOSE_ERROR_MESSAGES),
                      QLatin1String("Disable verbose error messages. Turn the python code hard to debug\n"
                                    "but safe few kB on the generated bindings."))
         << qMakePair(QLatin1String(PARENT_CTOR_HEURISTIC),
                      QLatin1String("Enable heuristics to detect parent relationship on constructors."))
+        << qMakePair(QLatin1String(LAZY_TYPE_INITIALIZATION),
+                     QLatin1String("Create the types of the module on first access instead of\n"
+                                   "at import (all dependent modules need to use it as well)."))
         << qMakePair(QLatin1String(ENABLE_PYSIDE_EXTENSIONS),
                      QLatin1String("Enable PySide extensions, such as support for signal/slots,\n"
                                    "use this if you are creating a binding for a Qt-based library."))
@@ -2604,6 +2662,10 @@ bool ShibokenGenerator::handleOption(const QString &key, const QString & /* valu
         return (m_avoidProtectedHack = true);
     if (key == QLatin1String(WRAPPER_DIAGNOSTICS))
         return (m_wrapperDiagnostics = true);
+    if (key == QLatin1String(COMPACT_ARGUMENT_PARSING))
+        return (m_compactArgumentParsing = true);
+    if (key == QLatin1String(LAZY_TYPE_INITIALIZATION))
+        return (m_lazyTypeInitialization = true);
     return false;
 }
 
@@ -2737,6 +2799,12 @@ QString ShibokenGenerator::convertersVariableName(const QString &moduleName) con
     return result;
 }
 
+QString ShibokenGenerator::methodNamesVariableName(const QString &moduleName) const
+{
+    return QLatin1String("Sbk") + moduleCppPrefix(moduleName)
+        + QLatin1String("MethodNames");
+}
+
 static QString processInstantiationsVariableName(const AbstractMetaType *type)
 {
     QString res = QLatin1Char('_') + _fixedCppTypeName(type->typeEntry()->qualifiedCppName()).toUpper();
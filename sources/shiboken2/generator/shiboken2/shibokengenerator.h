@@ -228,6 +228,14 @@ protected:
     /// Verifies if the class should have a C++ wrapper generated for it, instead of only a Python wrapper.
     bool shouldGenerateCppWrapper(const AbstractMetaClass *metaClass) const;
 
+    /// Returns true if the C++ instances of \p metaClass are constructed inside
+    /// the Python wrapper (value-type attribute "inline-storage").
+    bool useInlineStorage(const AbstractMetaClass *metaClass) const;
+
+    /// Returns the class (\p metaClass or a base class) using inline storage
+    /// that determines the instance size of the Python type, if any.
+    const AbstractMetaClass *inlineStorageClass(const AbstractMetaClass *metaClass) const;
+
     /// Condition to call WriteVirtualMethodNative. Was extracted because also used to count these calls.
     bool shouldWriteVirtualMethodNative(const AbstractMetaFunction *func);
 
@@ -279,6 +287,15 @@ protected:
      */
     static bool isObjectTypeUsedAsValueType(const AbstractMetaType *type);
 
+    /**
+     *  Returns true if \p type is a non-const Value Type passed by value,
+     *  which can be moved to Python (see Shiboken::Conversions::moveToPython()).
+     */
+    static bool isValueTypeUsedAsMovableValue(const AbstractMetaType *type);
+
+    /// Returns true if a C++ to Python move conversion is generated for \p metaClass.
+    static bool hasMoveToPythonConversion(const AbstractMetaClass *metaClass);
+
     static bool isValueTypeWithCopyConstructorOnly(const AbstractMetaClass *metaClass);
     bool isValueTypeWithCopyConstructorOnly(const TypeEntry *type) const;
     bool isValueTypeWithCopyConstructorOnly(const AbstractMetaType *type) const;
@@ -314,6 +331,10 @@ protected:
     static QString cpythonTypeName(const TypeEntry *type);
     QString cpythonTypeNameExt(const TypeEntry *type) const;
     QString cpythonTypeNameExt(const AbstractMetaType *type) const;
+    /// Returns the entry of the module type array for assignment, which differs
+    /// from cpythonTypeNameExt() in lazy type initialization mode.
+    QString cpythonTypeArrayEntry(const TypeEntry *type) const;
+    QString cpythonTypeArrayEntry(const AbstractMetaType *type) const;
     QString cpythonCheckFunction(const TypeEntry *type, bool genericNumberType = false);
     QString cpythonCheckFunction(const AbstractMetaType *metaType, bool genericNumberType = false);
     /**
@@ -387,6 +408,8 @@ protected:
     QString cppApiVariableName(const QString &moduleName = QString()) const;
     QString pythonModuleObjectName(const QString &moduleName = QString()) const;
     QString convertersVariableName(const QString &moduleName = QString()) const;
+    /// Returns the name of the array holding the interned virtual method names of the module.
+    QString methodNamesVariableName(const QString &moduleName = QString()) const;
     /**
      *  Returns the type index variable name for a given class. If \p alternativeTemplateName is true
      *  and the class is a typedef for a template class instantiation, it will return an alternative name
@@ -400,6 +423,12 @@ protected:
     /// Returns true if the user don't want verbose error messages on the generated bindings.
     bool verboseErrorMessagesDisabled() const;
 
+    /// Returns true if argument count checks and keyword argument resolution
+    /// should be delegated to table-driven helpers of libshiboken.
+    bool compactArgumentParsing() const { return m_compactArgumentParsing; }
+    /// Returns true if the types of the module should be created on first access.
+    bool lazyTypeInitialization() const { return m_lazyTypeInitialization; }
+
     /**
      *   Builds an AbstractMetaType object from a QString.
      *   Returns nullptr if no type could be built from the string.
@@ -569,6 +598,8 @@ private:
     bool m_useIsNullAsNbNonZero = false;
     bool m_avoidProtectedHack = false;
     bool m_wrapperDiagnostics = false;
+    bool m_compactArgumentParsing = false;
+    bool m_lazyTypeInitialization = false;
 
     using AbstractMetaTypeCache = QHash<QString, AbstractMetaType *>;
     AbstractMetaTypeCache m_metaTypeFromStringCache;
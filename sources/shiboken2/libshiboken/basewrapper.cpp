@@ -51,7 +51,10 @@
 #include <string>
 #include <cstring>
 #include <cstddef>
+#include <deque>
+#include <new>
 #include <set>
+#include <unordered_map>
 #include <sstream>
 #include <algorithm>
 #include "threadstatesaver.h"
@@ -317,11 +320,8 @@ static int SbkObject_traverse(PyObject *self, visitproc visit, void *arg)
     }
 
     //Visit refs
-    Shiboken::RefCountMap *rInfo = sbkSelf->d->referredObjects;
-    if (rInfo) {
-        for (auto it = rInfo->begin(), end = rInfo->end(); it != end; ++it)
-            Py_VISIT(it->second);
-    }
+    for (const auto &ref : sbkSelf->d->referredObjects)
+        Py_VISIT(ref.second);
 
     if (sbkSelf->ob_dict)
         Py_VISIT(sbkSelf->ob_dict);
@@ -385,6 +385,70 @@ SbkObjectType *SbkObject_TypeF(void)
     return reinterpret_cast<SbkObjectType *>(type);
 }
 
+// Types using inline storage (see Shiboken::ObjectType::setInlineStorage())
+// lay out their instances as [SbkObject][SbkObjectPrivate][C++ instance].
+static constexpr size_t alignedSize(size_t size, size_t alignment)
+{
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+static constexpr size_t inlinePrivateOffset =
+    alignedSize(sizeof(SbkObject), alignof(SbkObjectPrivate));
+
+// Python objects are guaranteed to be aligned to pointers only.
+static constexpr size_t maxInlineAlignment = alignof(void *);
+
+static size_t inlineCppOffset(size_t alignment)
+{
+    return alignedSize(inlinePrivateOffset + sizeof(SbkObjectPrivate), alignment);
+}
+
+static void *inlineCppAddress(SbkObject *self)
+{
+    const Py_ssize_t offset = PepType_SOTP(Py_TYPE(self))->inline_cpp_offset;
+    return offset != 0 ? reinterpret_cast<char *>(self) + offset : nullptr;
+}
+
+// Destroy a C++ instance constructed inside the Python object; its memory
+// is released along with the Python object.
+static void destroyInlineCppObject(SbkObject *self)
+{
+    self->d->cppObjectInline = 0;
+    PepType_SOTP(Py_TYPE(self))->inline_dtor(self->d->cptr[0]);
+}
+
+// Free lists of deallocated instances, see Shiboken::ObjectType::setFreeListSize().
+// Instances of Python subclasses never qualify since their type data is not inherited.
+static SbkObject *takeFromFreeList(PyTypeObject *type)
+{
+    SbkObjectTypePrivate *sotp = PepType_SOTP(type);
+    SbkObject *self = sotp ? sotp->free_list : nullptr;
+    if (self != nullptr) {
+        sotp->free_list = reinterpret_cast<SbkObject *>(self->ob_dict);
+        --sotp->free_list_size;
+        PyObject_Init(reinterpret_cast<PyObject *>(self), type);
+    }
+    return self;
+}
+
+static bool putOnFreeList(SbkObject *self)
+{
+    SbkObjectTypePrivate *sotp = PepType_SOTP(Py_TYPE(self));
+    if (sotp == nullptr || sotp->free_list_size >= sotp->free_list_max_size)
+        return false;
+    self->ob_dict = reinterpret_cast<PyObject *>(sotp->free_list);
+    sotp->free_list = self;
+    ++sotp->free_list_size;
+    return true;
+}
+
+static void freeCppPointerArray(SbkObjectPrivate *d)
+{
+    if (d->cptr != d->cptrStorage)
+        delete[] d->cptr;
+    d->cptr = nullptr;
+}
+
 static int mainThreadDeletionHandler(void *)
 {
     if (Py_IsInitialized())
@@ -466,6 +530,12 @@ static void SbkDeallocWrapperCommon(PyObject *pyObj, bool canDelete)
     /* Save the current exception, if any. */
     PyErr_Fetch(&error_type, &error_value, &error_traceback);
 
+    // A C++ instance constructed inside the Python object cannot outlive it.
+    if (sbkObj->d->cppObjectInline) {
+        destroyInlineCppObject(sbkObj);
+        canDelete = false;
+    }
+
     if (canDelete) {
         if (sotp->is_multicpp) {
             Shiboken::DtorAccumulatorVisitor visitor(sbkObj);
@@ -532,6 +602,10 @@ void SbkObjectTypeDealloc(PyObject *pyObj)
         sotp->original_name = nullptr;
         if (!Shiboken::ObjectType::isUserType(type))
             Shiboken::Conversions::deleteConverter(sotp->converter);
+        // Release the recycled instances, they do not keep the type alive.
+        Shiboken::ObjectType::setFreeListSize(reinterpret_cast<SbkObjectType *>(type), 0);
+        // A type allocated later at the same address must not see the enums.
+        Shiboken::Enum::removePendingScope(type);
         delete sotp;
         sotp = nullptr;
     }
@@ -617,7 +691,9 @@ static PyObject *mangled_type_getattro(PyTypeObject *type, PyObject *name)
      */
     if (SelectFeatureSet != nullptr)
         type->tp_dict = SelectFeatureSet(type);
-    return type_getattro(reinterpret_cast<PyObject *>(type), name);
+    PyObject *ret = type_getattro(reinterpret_cast<PyObject *>(type), name);
+    // Enum items are inserted into the type dict on first access.
+    return ret != nullptr ? ret : Shiboken::Enum::getPendingItem(type, name);
 }
 
 static PyObject *Sbk_TypeGet___dict__(PyTypeObject *type, void *context)
@@ -628,6 +704,10 @@ static PyObject *Sbk_TypeGet___dict__(PyTypeObject *type, void *context)
     auto dict = type->tp_dict;
     if (dict == nullptr)
         Py_RETURN_NONE;
+    // The enum items are inserted into the type dict, so create them before
+    // a feature dict is selected.
+    if (!Shiboken::Enum::createPendingItems(type))
+        return nullptr;
     if (SelectFeatureSet != nullptr)
         dict = SelectFeatureSet(type);
     return PyDictProxy_New(dict);
@@ -641,7 +721,8 @@ static PyObject *SbkObject_GenericGetAttr(PyObject *obj, PyObject *name)
     auto type = Py_TYPE(obj);
     if (SelectFeatureSet != nullptr)
         type->tp_dict = SelectFeatureSet(type);
-    return PyObject_GenericGetAttr(obj, name);
+    PyObject *ret = PyObject_GenericGetAttr(obj, name);
+    return ret != nullptr ? ret : Shiboken::Enum::getPendingItem(type, name);
 }
 
 static int SbkObject_GenericSetAttr(PyObject *obj, PyObject *name, PyObject *value)
@@ -753,6 +834,8 @@ static PyObject *SbkObjectTypeTpNew(PyTypeObject *metatype, PyObject *args, PyOb
         sotp->cpp_dtor = parentType->cpp_dtor;
         sotp->is_multicpp = 0;
         sotp->converter = parentType->converter;
+        sotp->inline_cpp_offset = parentType->inline_cpp_offset;
+        sotp->inline_dtor = parentType->inline_dtor;
     } else {
         sotp->mi_offsets = nullptr;
         sotp->mi_init = nullptr;
@@ -761,6 +844,8 @@ static PyObject *SbkObjectTypeTpNew(PyTypeObject *metatype, PyObject *args, PyOb
         sotp->cpp_dtor = nullptr;
         sotp->is_multicpp = 1;
         sotp->converter = nullptr;
+        sotp->inline_cpp_offset = 0;
+        sotp->inline_dtor = nullptr;
     }
     if (bases.size() == 1)
         sotp->original_name = strdup(PepType_SOTP(bases.front())->original_name);
@@ -783,29 +868,37 @@ static PyObject *SbkObjectTypeTpNew(PyTypeObject *metatype, PyObject *args, PyOb
 static PyObject *_setupNew(SbkObject *self, PyTypeObject *subtype)
 {
     Py_INCREF(reinterpret_cast<PyObject *>(subtype));
-    auto d = new SbkObjectPrivate;
 
     SbkObjectTypePrivate *sotp = PepType_SOTP(subtype);
+    const bool isInline = sotp && sotp->inline_cpp_offset != 0;
+    auto d = isInline
+        ? new (reinterpret_cast<char *>(self) + inlinePrivateOffset) SbkObjectPrivate
+        : new SbkObjectPrivate;
     int numBases = ((sotp && sotp->is_multicpp) ?
         Shiboken::getNumberOfCppBaseClasses(subtype) : 1);
-    d->cptr = new void *[numBases];
+    d->cptr = numBases == 1 ? d->cptrStorage : new void *[numBases];
     std::memset(d->cptr, 0, sizeof(void *) *size_t(numBases));
     d->hasOwnership = 1;
     d->containsCppWrapper = 0;
     d->validCppObject = 0;
     d->parentInfo = nullptr;
-    d->referredObjects = nullptr;
     d->cppObjectCreated = 0;
+    d->isQAppSingleton = 0;
+    d->isInline = isInline;
+    d->cppObjectInline = 0;
     self->ob_dict = nullptr;
     self->weakreflist = nullptr;
     self->d = d;
-    PyObject_GC_Track(reinterpret_cast<PyObject *>(self));
+    if (!(sotp && sotp->gc_untracked))
+        PyObject_GC_Track(reinterpret_cast<PyObject *>(self));
     return reinterpret_cast<PyObject *>(self);
 }
 
 PyObject *SbkObjectTpNew(PyTypeObject *subtype, PyObject *, PyObject *)
 {
-    SbkObject *self = PyObject_GC_New(SbkObject, subtype);
+    SbkObject *self = takeFromFreeList(subtype);
+    if (self == nullptr)
+        self = PyObject_GC_New(SbkObject, subtype);
     return _setupNew(self, subtype);
 }
 
@@ -1015,6 +1108,93 @@ void setErrorAboutWrongArguments(PyObject *args, const char *funcName, PyObject
     SetError_Argument(args, funcName, info);
 }
 
+void setErrorAboutWrongArgumentsStealInfo(PyObject *args, const char *funcName, PyObject *info)
+{
+    SetError_Argument(args, funcName, info);
+    Py_XDECREF(info);
+}
+
+bool checkArgumentCount(Py_ssize_t numArgs, int minArgs, int maxArgs, PyObject **errInfo)
+{
+    if (maxArgs >= 0 && numArgs > maxArgs) {
+        static PyObject *const tooMany = String::createStaticString(">");
+        *errInfo = tooMany;
+    } else if (numArgs < minArgs) {
+        static PyObject *const tooFew = String::createStaticString("<");
+        *errInfo = tooFew;
+    } else {
+        return true;
+    }
+    Py_INCREF(*errInfo);
+    return false;
+}
+
+static PythonToCppFunc checkKeywordArgument(const KeywordArgument &keyword, PyObject *value)
+{
+    switch (keyword.check) {
+    case KeywordArgument::ValueCheck:
+        return Conversions::isPythonToCppValueConvertible(keyword.type, value);
+    case KeywordArgument::PointerCheck:
+        return Conversions::isPythonToCppPointerConvertible(keyword.type, value);
+    case KeywordArgument::ReferenceCheck:
+        return Conversions::isPythonToCppReferenceConvertible(keyword.type, value);
+    case KeywordArgument::ConverterCheck:
+        return Conversions::isPythonToCppConvertible(keyword.converter, value);
+    case KeywordArgument::InlineCheck:
+        break;
+    }
+    return nullptr;
+}
+
+bool resolveKeywordArguments(PyObject *kwds, KeywordArgument *keywords, int count,
+                             PyObject **pyArgs, PythonToCppFunc *pythonToCpp,
+                             PyObject **errInfo, bool allowUnknown)
+{
+    Py_ssize_t found = 0;
+    for (int i = 0; i < count; ++i) {
+        KeywordArgument &keyword = keywords[i];
+        if (keyword.key == nullptr)
+            keyword.key = String::createStaticString(keyword.name);
+        PyObject *value = PyDict_GetItem(kwds, keyword.key);
+        if (value == nullptr)
+            continue;
+        if (pyArgs[keyword.index] != nullptr) {
+            *errInfo = keyword.key;
+            Py_INCREF(*errInfo);
+            return false;
+        }
+        pyArgs[keyword.index] = value;
+        ++found;
+        if (keyword.check != KeywordArgument::InlineCheck) {
+            PythonToCppFunc func = checkKeywordArgument(keyword, value);
+            if (func == nullptr)
+                return false;
+            pythonToCpp[keyword.index] = func;
+        }
+    }
+    if (found == PyDict_Size(kwds))
+        return true;
+
+    // Collect the unknown keywords for the error message or for the
+    // extra keyword signals and properties of QObject constructors.
+    PyObject *unknown = PyDict_Copy(kwds);
+    for (int i = 0; i < count; ++i) {
+        if (PyDict_GetItem(unknown, keywords[i].key) != nullptr)
+            PyDict_DelItem(unknown, keywords[i].key);
+    }
+    *errInfo = unknown;
+    return allowUnknown;
+}
+
+bool checkValidArguments(PyObject *const *pyArgs, unsigned mask)
+{
+    for (int i = 0; mask != 0; ++i, mask >>= 1) {
+        if ((mask & 1u) != 0 && !Object::isValid(pyArgs[i]))
+            return false;
+    }
+    return true;
+}
+
 class FindBaseTypeVisitor : public HierarchyVisitor
 {
 public:
@@ -1133,6 +1313,39 @@ void setDestructorFunction(SbkObjectType *type, ObjectDestructor func)
     PepType_SOTP(type)->cpp_dtor = func;
 }
 
+int inlineStorageBasicSize(size_t size, size_t alignment)
+{
+    if (alignment > maxInlineAlignment)
+        return int(sizeof(SbkObject));
+    return int(inlineCppOffset(alignment) + size);
+}
+
+void setInlineStorage(SbkObjectType *type, size_t size, size_t alignment,
+                      ObjectDestructor inPlaceDtor)
+{
+    SbkObjectTypePrivate *sotp = PepType_SOTP(type);
+    if (alignment > maxInlineAlignment || sotp->is_multicpp || sotp->delete_in_main_thread)
+        return;
+    const size_t offset = inlineCppOffset(alignment);
+    const auto basicSize = reinterpret_cast<PyTypeObject *>(type)->tp_basicsize;
+    if (size_t(basicSize) < offset + size)
+        return;
+    sotp->inline_cpp_offset = Py_ssize_t(offset);
+    sotp->inline_dtor = inPlaceDtor;
+}
+
+void setFreeListSize(SbkObjectType *type, int maxSize)
+{
+    SbkObjectTypePrivate *sotp = PepType_SOTP(type);
+    sotp->free_list_max_size = maxSize;
+    while (sotp->free_list_size > maxSize) {
+        SbkObject *self = sotp->free_list;
+        sotp->free_list = reinterpret_cast<SbkObject *>(self->ob_dict);
+        --sotp->free_list_size;
+        PyObject_GC_Del(self);
+    }
+}
+
 void initPrivateData(SbkObjectType *type)
 {
     PepType_SOTP(type) = new SbkObjectTypePrivate;
@@ -1175,6 +1388,8 @@ introduceWrapperType(PyObject *enclosingObject,
     auto sotp = PepType_SOTP(type);
     if (wrapperFlags & DeleteInMainThread)
         sotp->delete_in_main_thread = 1;
+    if (wrapperFlags & NoGcTracking)
+        sotp->gc_untracked = 1;
 
     setOriginalName(type, originalName);
     setDestructorFunction(type, cppObjDtor);
@@ -1319,6 +1534,8 @@ void callCppDestructors(SbkObject *pyObj)
         Shiboken::DtorAccumulatorVisitor visitor(pyObj);
         Shiboken::walkThroughClassHierarchy(type, &visitor);
         callDestructor(visitor.entries());
+    } else if (priv->cppObjectInline) {
+        destroyInlineCppObject(pyObj);
     } else {
         Shiboken::ThreadStateSaver threadSaver;
         threadSaver.save();
@@ -1335,8 +1552,7 @@ void callCppDestructors(SbkObject *pyObj)
        invalidate doesn't */
     invalidate(pyObj);
 
-    delete[] priv->cptr;
-    priv->cptr = nullptr;
+    freeCppPointerArray(priv);
     priv->validCppObject = false;
 }
 
@@ -1443,11 +1659,8 @@ static void recursive_invalidate(SbkObject *self, std::set<SbkObject *> &seen)
     }
 
     // If has ref to other objects invalidate all
-    if (self->d->referredObjects) {
-        RefCountMap &refCountMap = *(self->d->referredObjects);
-        for (auto it = refCountMap.begin(), end = refCountMap.end(); it != end; ++it)
-            recursive_invalidate(it->second, seen);
-    }
+    for (const auto &ref : self->d->referredObjects)
+        recursive_invalidate(ref.second, seen);
 }
 
 void makeValid(SbkObject *self)
@@ -1466,13 +1679,9 @@ void makeValid(SbkObject *self)
     }
 
     // If has ref to other objects make all valid again
-    if (self->d->referredObjects) {
-        RefCountMap &refCountMap = *(self->d->referredObjects);
-        RefCountMap::iterator iter;
-        for (auto it = refCountMap.begin(), end = refCountMap.end(); it != end; ++it) {
-            if (Shiboken::Object::checkType(it->second))
-                makeValid(reinterpret_cast<SbkObject *>(it->second));
-        }
+    for (const auto &ref : self->d->referredObjects) {
+        if (Shiboken::Object::checkType(ref.second))
+            makeValid(reinterpret_cast<SbkObject *>(ref.second));
     }
 }
 
@@ -1505,10 +1714,13 @@ bool setCppPointer(SbkObject *sbkObj, PyTypeObject *desiredType, void *cptr)
         idx = getTypeIndexOnHierarchy(type, desiredType);
 
     const bool alreadyInitialized = sbkObj->d->cptr[idx] != nullptr;
-    if (alreadyInitialized)
+    if (alreadyInitialized) {
         PyErr_SetString(PyExc_RuntimeError, "You can't initialize an object twice!");
-    else
+    } else {
         sbkObj->d->cptr[idx] = cptr;
+        if (cptr != nullptr && cptr == inlineCppAddress(sbkObj))
+            sbkObj->d->cppObjectInline = 1;
+    }
 
     sbkObj->d->cppObjectCreated = true;
     return !alreadyInitialized;
@@ -1653,6 +1865,26 @@ PyObject *newObject(SbkObjectType *instanceType,
     return reinterpret_cast<PyObject *>(self);
 }
 
+PyObject *newInlineObject(SbkObjectType *instanceType, void **cppStorage)
+{
+    if (PepType_SOTP(instanceType)->inline_cpp_offset == 0)
+        return nullptr;
+    auto *self = reinterpret_cast<SbkObject *>(SbkObjectTpNew(reinterpret_cast<PyTypeObject *>(instanceType), nullptr, nullptr));
+    void *cptr = inlineCppAddress(self);
+    self->d->cptr[0] = cptr;
+    self->d->validCppObject = 1;
+    self->d->cppObjectInline = 1;
+    BindingManager::instance().registerWrapper(self, cptr);
+    *cppStorage = cptr;
+    return reinterpret_cast<PyObject *>(self);
+}
+
+void *inlineCppStorage(SbkObject *pyObj)
+{
+    return pyObj->d->cptr && pyObj->d->cptr[0] == nullptr
+        ? inlineCppAddress(pyObj) : nullptr;
+}
+
 void destroy(SbkObject *self, void *cppData)
 {
     // Skip if this is called with NULL pointer this can happen in derived classes
@@ -1690,8 +1922,7 @@ void destroy(SbkObject *self, void *cppData)
         self->d->hasOwnership = false;
 
         // the cpp object instance was deleted
-        delete[] self->d->cptr;
-        self->d->cptr = nullptr;
+        freeCppPointerArray(self->d);
     }
 
     // After this point the object can be death do not use the self pointer bellow
@@ -1813,15 +2044,17 @@ void deallocData(SbkObject *self, bool cleanup)
     if (self->d->cptr) {
         // Remove from BindingManager
         Shiboken::BindingManager::instance().releaseWrapper(self);
-        delete[] self->d->cptr;
-        self->d->cptr = nullptr;
+        freeCppPointerArray(self->d);
         // delete self->d; PYSIDE-205: wrong!
     }
-    delete self->d; // PYSIDE-205: always delete d.
+    if (self->d->isInline)
+        self->d->~SbkObjectPrivate();
+    else
+        delete self->d; // PYSIDE-205: always delete d.
     Py_XDECREF(self->ob_dict);
 
     // PYSIDE-571: qApp is no longer allocated.
-    if (PyObject_IS_GC(reinterpret_cast<PyObject *>(self)))
+    if (PyObject_IS_GC(reinterpret_cast<PyObject *>(self)) && !putOnFreeList(self))
         Py_TYPE(self)->tp_free(self);
 }
 
@@ -1845,62 +2078,87 @@ static inline bool isNone(const PyObject *o)
     return o == nullptr || o == Py_None;
 }
 
-static void removeRefCountKey(SbkObject *self, const char *key)
+// The keys of keepReference() by id. A deque does not move the strings.
+static std::deque<std::string> &referenceKeys()
 {
-    if (self->d->referredObjects) {
-        const auto iterPair = self->d->referredObjects->equal_range(key);
-        if (iterPair.first != iterPair.second) {
-            decRefPyObjectList(iterPair.first, iterPair.second);
-            self->d->referredObjects->erase(iterPair.first, iterPair.second);
-        }
+    static std::deque<std::string> result;
+    return result;
+}
+
+int referenceKeyId(const char *key)
+{
+    static std::unordered_map<std::string, int> ids;
+    auto it = ids.find(key);
+    if (it != ids.end())
+        return it->second;
+    auto &keys = referenceKeys();
+    const int id = int(keys.size());
+    keys.emplace_back(key);
+    ids.insert({keys.back(), id});
+    return id;
+}
+
+const char *referenceKey(int keyId)
+{
+    const auto &keys = referenceKeys();
+    return keyId >= 0 && std::size_t(keyId) < keys.size() ? keys[keyId].c_str() : nullptr;
+}
+
+static void removeRefCountKey(SbkObject *self, int keyId)
+{
+    RefCountList &refCountList = self->d->referredObjects;
+    // Move the entries of the key to the end, keeping the order of the others.
+    const auto first = std::stable_partition(refCountList.begin(), refCountList.end(),
+        [keyId](const RefCountList::value_type &v) { return v.first != keyId; });
+    if (first != refCountList.end()) {
+        decRefPyObjectList(first, refCountList.end());
+        refCountList.erase(first, refCountList.end());
     }
 }
 
-void keepReference(SbkObject *self, const char *key, PyObject *referredObject, bool append)
+void keepReference(SbkObject *self, int keyId, PyObject *referredObject, bool append)
 {
     if (isNone(referredObject)) {
-        removeRefCountKey(self, key);
+        removeRefCountKey(self, keyId);
         return;
     }
 
-    if (!self->d->referredObjects) {
-        self->d->referredObjects =
-            new Shiboken::RefCountMap{RefCountMap::value_type{key, referredObject}};
-        Py_INCREF(referredObject);
+    RefCountList &refCountList = self->d->referredObjects;
+    if (std::any_of(refCountList.begin(), refCountList.end(),
+                    [keyId, referredObject](const RefCountList::value_type &v) {
+                        return v.first == keyId && v.second == referredObject;
+                    })) {
         return;
     }
+    if (!append)
+        removeRefCountKey(self, keyId);
 
-    RefCountMap &refCountMap = *(self->d->referredObjects);
-    const auto iterPair = refCountMap.equal_range(key);
-    if (std::any_of(iterPair.first, iterPair.second,
-                    [referredObject](const RefCountMap::value_type &v) { return v.second == referredObject; })) {
-        return;
-    }
+    refCountList.append(keyId, referredObject);
+    Py_INCREF(referredObject);
+}
 
-    if (!append && iterPair.first != iterPair.second) {
-        decRefPyObjectList(iterPair.first, iterPair.second);
-        refCountMap.erase(iterPair.first, iterPair.second);
-    }
+void keepReference(SbkObject *self, const char *key, PyObject *referredObject, bool append)
+{
+    keepReference(self, referenceKeyId(key), referredObject, append);
+}
 
-    refCountMap.insert(RefCountMap::value_type{key, referredObject});
-    Py_INCREF(referredObject);
+void removeReference(SbkObject *self, int keyId, PyObject *referredObject)
+{
+    if (!isNone(referredObject))
+        removeRefCountKey(self, keyId);
 }
 
 void removeReference(SbkObject *self, const char *key, PyObject *referredObject)
 {
-    if (!isNone(referredObject))
-        removeRefCountKey(self, key);
+    removeReference(self, referenceKeyId(key), referredObject);
 }
 
 void clearReferences(SbkObject *self)
 {
-    if (!self->d->referredObjects)
-        return;
-
-    RefCountMap &refCountMap = *(self->d->referredObjects);
-    for (auto it = refCountMap.begin(), end = refCountMap.end(); it != end; ++it)
-        Py_DECREF(it->second);
-    self->d->referredObjects->clear();
+    RefCountList &refCountList = self->d->referredObjects;
+    for (const auto &ref : refCountList)
+        Py_DECREF(ref.second);
+    refCountList.clear();
 }
 
 std::string info(SbkObject *self)
@@ -1946,16 +2204,16 @@ std::string info(SbkObject *self)
         s << '\n';
     }
 
-    if (self->d->referredObjects && !self->d->referredObjects->empty()) {
-        Shiboken::RefCountMap &map = *self->d->referredObjects;
+    if (!self->d->referredObjects.empty()) {
+        const Shiboken::RefCountList &list = self->d->referredObjects;
         s << "referred objects.. ";
-        std::string lastKey;
-        for (auto it = map.begin(), end = map.end(); it != end; ++it) {
-            if (it->first != lastKey) {
-                if (!lastKey.empty())
+        int lastKeyId = -1;
+        for (auto it = list.begin(), end = list.end(); it != end; ++it) {
+            if (it->first != lastKeyId) {
+                if (lastKeyId != -1)
                     s << "                   ";
-                s << '"' << it->first << "\" => ";
-                lastKey = it->first;
+                s << '"' << referenceKey(it->first) << "\" => ";
+                lastKeyId = it->first;
             }
             Shiboken::AutoDecRef obj(PyObject_Str(it->second));
             s << String::toCString(obj) << ' ';
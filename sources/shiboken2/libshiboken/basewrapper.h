@@ -42,6 +42,7 @@
 
 #include "sbkpython.h"
 #include "shibokenmacros.h"
+#include "sbkconverter.h"
 
 #include <vector>
 #include <string>
@@ -165,11 +166,67 @@ void callCppDestructor(void *cptr)
     delete reinterpret_cast<T *>(cptr);
 }
 
+/// Destroy the class T constructed in place on \p cptr without freeing its memory.
+template<typename T>
+void callCppInPlaceDestructor(void *cptr)
+{
+    reinterpret_cast<T *>(cptr)->~T();
+}
+
 // setErrorAboutWrongArguments now gets overload information from the signature module.
 // The extra info argument can contain additional data about the error.
 LIBSHIBOKEN_API void setErrorAboutWrongArguments(PyObject *args, const char *funcName,
                                                  PyObject *info);
 
+/// Same as setErrorAboutWrongArguments(), releasing the reference to \p info.
+LIBSHIBOKEN_API void setErrorAboutWrongArgumentsStealInfo(PyObject *args, const char *funcName,
+                                                          PyObject *info);
+
+/// Descriptor of a keyword argument of a function wrapper, used by
+/// resolveKeywordArguments(). The key string is created on first use.
+/// \p check specifies the type check of the argument against \p type or
+/// \p converter; for InlineCheck, it is left to the function wrapper.
+struct KeywordArgument
+{
+    enum Check { InlineCheck, ValueCheck, PointerCheck, ReferenceCheck, ConverterCheck };
+
+    const char *name;
+    int index; // Index into the Python argument array
+    PyObject *key;
+    Check check;
+    SbkObjectType *type;
+    const SbkConverter *converter;
+};
+
+/**
+*   Checks the number of arguments passed to a function wrapper against its
+*   minimum and maximum (-1 for no maximum). On failure, \p errInfo receives
+*   a new reference to the error information expected by
+*   setErrorAboutWrongArguments().
+*/
+LIBSHIBOKEN_API bool checkArgumentCount(Py_ssize_t numArgs, int minArgs, int maxArgs,
+                                        PyObject **errInfo);
+
+/**
+*   Moves the values of the keyword arguments \p kwds into \p pyArgs as
+*   described by the \p count entries of \p keywords, and stores the
+*   converter functions of the arguments checked there in \p pythonToCpp.
+*   Fails if a keyword argument was also passed positionally, if its type
+*   check fails, or if unknown keywords remain and \p allowUnknown is false.
+*   \p errInfo receives a new reference to the error information or to the
+*   dictionary of unknown keywords.
+*/
+LIBSHIBOKEN_API bool resolveKeywordArguments(PyObject *kwds, KeywordArgument *keywords,
+                                             int count, PyObject **pyArgs,
+                                             PythonToCppFunc *pythonToCpp,
+                                             PyObject **errInfo, bool allowUnknown);
+
+/**
+*   Checks the validity of the wrapper arguments of a function wrapper whose
+*   positions in \p pyArgs are set in \p mask (see Object::isValid()).
+*/
+LIBSHIBOKEN_API bool checkValidArguments(PyObject *const *pyArgs, unsigned mask);
+
 namespace ObjectType {
 
 /**
@@ -215,12 +272,36 @@ LIBSHIBOKEN_API MultipleInheritanceInitFunction getMultipleInheritanceFunction(S
 
 LIBSHIBOKEN_API void setDestructorFunction(SbkObjectType *self, ObjectDestructor func);
 
+/**
+ *  Returns the basic size of a wrapper type constructing its C++ instances of
+ *  \p size bytes inside the Python object, see setInlineStorage().
+ *  Returns sizeof(SbkObject) if \p alignment cannot be honored.
+ */
+LIBSHIBOKEN_API int inlineStorageBasicSize(size_t size, size_t alignment);
+
+/**
+ *  Lets \p type construct its C++ instances inside the Python object, saving
+ *  the allocations of the C++ instance and of the private data.
+ *  \p type must have been created with inlineStorageBasicSize() as basic size,
+ *  otherwise the call is ignored as it is for multiple inheritance.
+ *  \param inPlaceDtor  Destroys a C++ instance without freeing its memory.
+ */
+LIBSHIBOKEN_API void setInlineStorage(SbkObjectType *type, size_t size, size_t alignment,
+                                      ObjectDestructor inPlaceDtor);
+
+/**
+ *  Keeps up to \p maxSize deallocated instances of \p type for reuse by new
+ *  instances, instead of returning their memory to the allocator.
+ */
+LIBSHIBOKEN_API void setFreeListSize(SbkObjectType *type, int maxSize);
+
 LIBSHIBOKEN_API void initPrivateData(SbkObjectType *self);
 
 enum WrapperFlags
 {
     InnerClass = 0x1,
-    DeleteInMainThread = 0x2
+    DeleteInMainThread = 0x2,
+    NoGcTracking = 0x4
 };
 
 /**
@@ -324,6 +405,22 @@ LIBSHIBOKEN_API PyObject *newObject(SbkObjectType *instanceType,
                                     bool isExactType = false,
                                     const char *typeName = nullptr);
 
+/**
+ *  Create a Python object owning a C++ instance of \p instanceType which
+ *  the caller constructs at \p cppStorage, inside the Python object.
+ *  The construction must not throw.
+ *  \returns nullptr if \p instanceType does not use inline storage.
+ *  \see ObjectType::setInlineStorage()
+ */
+LIBSHIBOKEN_API PyObject *newInlineObject(SbkObjectType *instanceType, void **cppStorage);
+
+/**
+ *  Returns where a constructor may construct the C++ instance of \p pyObj
+ *  inside the Python object, or nullptr if its type does not use inline
+ *  storage or the instance is already set.
+ */
+LIBSHIBOKEN_API void *inlineCppStorage(SbkObject *pyObj);
+
 /**
  *  Changes the valid flag of a PyObject, invalid objects will raise an exception when someone tries to access it.
  */
@@ -474,6 +571,20 @@ LIBSHIBOKEN_API void *getTypeUserData(SbkObject *wrapper);
  */
 LIBSHIBOKEN_API void keepReference(SbkObject *self, const char *key, PyObject *referredObject, bool append = false);
 
+/**
+ *   Same as above, with the key identified by an id returned by referenceKeyId().
+ */
+LIBSHIBOKEN_API void keepReference(SbkObject *self, int keyId, PyObject *referredObject, bool append = false);
+
+/**
+ *   Returns the id of a key of keepReference(). The ids are kept for the life time of
+ *   the process, so the keys should come from a fixed set like the method signatures.
+ */
+LIBSHIBOKEN_API int referenceKeyId(const char *key);
+
+/// Returns the key of an id returned by referenceKeyId() or nullptr if there is none.
+LIBSHIBOKEN_API const char *referenceKey(int keyId);
+
 /**
  *   Removes any reference previously added by keepReference function
  *   \param self            the wrapper instance that keeps references to other objects.
@@ -482,6 +593,11 @@ LIBSHIBOKEN_API void keepReference(SbkObject *self, const char *key, PyObject *r
  */
 LIBSHIBOKEN_API void removeReference(SbkObject *self, const char *key, PyObject *referredObject);
 
+/**
+ *   Same as above, with the key identified by an id returned by referenceKeyId().
+ */
+LIBSHIBOKEN_API void removeReference(SbkObject *self, int keyId, PyObject *referredObject);
+
 } // namespace Object
 
 } // namespace Shiboken
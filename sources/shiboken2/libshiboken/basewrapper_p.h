@@ -43,9 +43,11 @@
 #include "sbkpython.h"
 #include "basewrapper.h"
 
-#include <unordered_map>
+#include <algorithm>
+#include <cstddef>
 #include <set>
 #include <string>
+#include <utility>
 #include <vector>
 
 struct SbkObject;
@@ -55,10 +57,71 @@ struct SbkConverter;
 namespace Shiboken
 {
 /**
-    * This mapping associates a method and argument of an wrapper object with the wrapper of
+    * This list associates a method and argument of an wrapper object with the wrapper of
     * said argument when it needs the binding to help manage its reference count.
+    * The methods and arguments are identified by the key ids of Object::referenceKeyId().
+    * The first entries are stored inline since most wrappers keep only a few references;
+    * the list moves to the heap when it grows beyond that.
     */
-using RefCountMap = std::unordered_multimap<std::string, PyObject *> ;
+class RefCountList
+{
+public:
+    using value_type = std::pair<int, PyObject *>;
+    using iterator = value_type *;
+    using const_iterator = const value_type *;
+
+    RefCountList() = default;
+    RefCountList(const RefCountList &) = delete;
+    RefCountList &operator=(const RefCountList &) = delete;
+
+    ~RefCountList()
+    {
+        if (m_data != m_inline)
+            delete [] m_data;
+    }
+
+    bool empty() const { return m_size == 0; }
+    std::size_t size() const { return m_size; }
+    std::size_t capacity() const { return m_capacity; }
+    /// Returns whether the entries are stored in the object itself.
+    bool isInline() const { return m_data == m_inline; }
+    /// Returns the number of bytes allocated on the heap for the entries.
+    std::size_t heapSize() const { return isInline() ? 0 : m_capacity * sizeof(value_type); }
+
+    iterator begin() { return m_data; }
+    iterator end() { return m_data + m_size; }
+    const_iterator begin() const { return m_data; }
+    const_iterator end() const { return m_data + m_size; }
+
+    void append(int keyId, PyObject *object)
+    {
+        if (m_size == m_capacity) {
+            auto *data = new value_type[2 * m_capacity];
+            std::copy(begin(), end(), data);
+            if (m_data != m_inline)
+                delete [] m_data;
+            m_data = data;
+            m_capacity *= 2;
+        }
+        m_data[m_size++] = value_type(keyId, object);
+    }
+
+    void erase(iterator first, iterator last)
+    {
+        std::copy(last, end(), first);
+        m_size -= last - first;
+    }
+
+    void clear() { m_size = 0; }
+
+private:
+    static const std::size_t inlineSize = 3;
+
+    value_type m_inline[inlineSize];
+    value_type *m_data = m_inline;
+    std::size_t m_size = 0;
+    std::size_t m_capacity = inlineSize;
+};
 
 /// Linked list of SbkBaseWrapper pointers
 using ChildrenList = std::set<SbkObject *>;
@@ -100,17 +163,21 @@ struct SbkObjectPrivate
     /// PYSIDE-1470: Marked as true if this is the Q*Application singleton.
     /// This bit allows app deletion from shiboken?.delete() .
     unsigned int isQAppSingleton : 1;
+    /// Marked as true when this structure is stored inside the Python object.
+    unsigned int isInline : 1;
+    /// Marked as true when the C++ object was constructed inside the Python object.
+    unsigned int cppObjectInline : 1;
     /// Information about the object parents and children, may be null.
     Shiboken::ParentInfo *parentInfo;
     /// Manage reference count of objects that are referred to but not owned from.
-    Shiboken::RefCountMap *referredObjects;
+    Shiboken::RefCountList referredObjects;
+    /// Storage of cptr for objects holding a single C++ instance.
+    void *cptrStorage[1];
 
     ~SbkObjectPrivate()
     {
         delete parentInfo;
         parentInfo = nullptr;
-        delete referredObjects;
-        referredObjects = nullptr;
     }
 };
 
@@ -143,6 +210,8 @@ struct SbkObjectTypePrivate
     // TODO-CONVERTERS: to be deprecated/removed
     unsigned int type_behaviour : 2;
     unsigned int delete_in_main_thread : 1;
+    /// True if the instances are not tracked by the garbage collector.
+    unsigned int gc_untracked : 1;
     /// C++ name
     char *original_name;
     /// Type user data
@@ -150,6 +219,14 @@ struct SbkObjectTypePrivate
     DeleteUserDataFunc d_func;
     void (*subtype_init)(SbkObjectType *, PyObject *, PyObject *);
     const char **propertyStrings;
+    /// Offset of the C++ instance constructed inside the Python object, 0 if unused.
+    Py_ssize_t inline_cpp_offset;
+    /// Destroys a C++ instance constructed inside the Python object.
+    ObjectDestructor inline_dtor;
+    /// Deallocated instances kept for reuse, linked through SbkObject::ob_dict.
+    SbkObject *free_list;
+    int free_list_size;
+    int free_list_max_size;
 };
 
 
@@ -282,6 +282,8 @@ static inline int currentSelectId(PyTypeObject *type)
     return sel;
 }
 
+static PyObject *findOverride(SbkObject *wrapper, PyObject *pyMethodName);
+
 PyObject *BindingManager::getOverride(const void *cptr,
                                       PyObject *nameCache[],
                                       const char *methodName)
@@ -306,7 +308,30 @@ PyObject *BindingManager::getOverride(const void *cptr,
         pyMethodName = Shiboken::String::getSnakeCaseName(methodName, flag);
         nameCache[(flag & 1) != 0] = pyMethodName;
     }
+    return findOverride(wrapper, pyMethodName);
+}
+
+PyObject *BindingManager::getOverride(const void *cptr,
+                                      PyObject *const methodNames[],
+                                      int propFlag)
+{
+    SbkObject *wrapper = retrieveWrapper(cptr);
+    // The refcount can be 0 if the object is dieing and someone called
+    // a virtual method from the destructor
+    if (!wrapper || reinterpret_cast<const PyObject *>(wrapper)->ob_refcnt == 0)
+        return nullptr;
 
+    int flag = currentSelectId(Py_TYPE(wrapper));
+    if ((flag & 0x02) != 0 && (propFlag & 3) != 0) {
+        // PYSIDE-1019: Handle overriding with properties.
+        // They cannot be overridden (make that sure by the metaclass).
+        return nullptr;
+    }
+    return findOverride(wrapper, methodNames[(flag & 1) != 0]);
+}
+
+static PyObject *findOverride(SbkObject *wrapper, PyObject *pyMethodName)
+{
     if (wrapper->ob_dict) {
         PyObject *method = PyDict_GetItem(wrapper->ob_dict, pyMethodName);
         if (method) {
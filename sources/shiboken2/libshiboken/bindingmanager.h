@@ -74,6 +74,9 @@ public:
 
     SbkObject *retrieveWrapper(const void *cptr);
     PyObject *getOverride(const void *cptr, PyObject *nameCache[], const char *methodName);
+    /// Returns the Python override of a virtual method. \p methodNames holds the
+    /// interned method name and its snake_case form, \p propFlag the property flags.
+    PyObject *getOverride(const void *cptr, PyObject *const methodNames[], int propFlag);
 
     void addClassInheritance(SbkObjectType *parent, SbkObjectType *child);
     /**
@@ -40,29 +40,41 @@
 """
 embedding_generator.py
 
-This file takes the content of the two supported directories and inserts
-it into a zip file. The zip file is then converted into a C++ source
-file that can easily be unpacked again with Python (see signature.cpp,
-constant 'PySide_PythonCode').
+This file takes the content of the two supported directories and compiles
+it into an archive of marshalled code objects. The archive is then converted
+into a C++ source file as a byte array (see signature_globals.cpp, constant
+'PySide_SignatureArchive').
 
-Note that this _is_ a zipfile, but since it is embedded into the shiboken
-binary, we cannot use the zipimport module from Python.
-But a similar solution is possible that allows for normal imports.
+The archive is a marshalled tuple
 
-See signature_bootstrap.py for details.
+    (magic, {module_name: (is_package, filename, code, source)})
+
+where 'code' is the marshalled code object as bytes and 'magic' the bytecode
+magic number of the Python version that compiled it. Since the format of the
+outer tuple does not depend on the Python version, the importer can check the
+magic number before unmarshalling a code object. 'source' is only kept for
+the limited API, where the code objects are compiled again when the Python
+version differs.
+
+The archive is imported by a meta path finder directly from memory, without
+unpacking a zip file to disk. See signature_bootstrap.py for details.
 """
 
 from __future__ import print_function, absolute_import
 
 import sys
 import os
-import subprocess
 import textwrap
-import tempfile
 import argparse
 import marshal
 import traceback
 
+try:
+    from importlib.util import MAGIC_NUMBER
+except ImportError:
+    from imp import get_magic
+    MAGIC_NUMBER = get_magic()
+
 # work_dir is set to the source for testing, onl.
 # It can be overridden in the command line.
 work_dir = os.path.abspath(os.path.dirname(__file__))
@@ -78,25 +90,15 @@ sys.path.insert(0, build_script_dir)
 from build_scripts import utils
 
 
-def runpy(cmd, **kw):
-    subprocess.call([sys.executable, '-E'] + cmd.split(), **kw)
-
-
-def create_zipfile(limited_api):
+def create_archive(limited_api):
     """
-    Collect all Python files, compile them, create a zip file
-    and make a chunked base64 encoded file from it.
+    Collect all Python files, compile them and create a C++ include file
+    with an archive of the marshalled code objects.
     """
-    zip_name = "signature.zip"
     inc_name = "signature_inc.h"
-    flag = '-b' if sys.version_info >= (3,) else ''
     os.chdir(work_dir)
 
     # Remove all left-over py[co] and other files first, in case we use '--reuse-build'.
-    # Note that we could improve that with the PyZipfile function to use .pyc files
-    # in different folders, but that makes only sense when COIN allows us to have
-    # multiple Python versions in parallel.
-    from os.path import join, getsize
     for root, dirs, files in os.walk(work_dir):
         for name in files:
             fpath = os.path.join(root, name)
@@ -115,105 +117,80 @@ def create_zipfile(limited_api):
     if embed_dir != work_dir:
         utils.copyfile(os.path.join(embed_dir, "signature_bootstrap.py"), work_dir)
 
-    if limited_api:
-        pass   # We cannot compile, unless we have folders per Python version
-    else:
-        files = ' '.join(fn for fn in os.listdir('.'))
-        runpy('-m compileall -q {flag} {files}'.format(**locals()))
-    files = ' '.join(fn for fn in os.listdir('.') if not fn == zip_name)
-    runpy('-m zipfile -c {zip_name} {files}'.format(**locals()))
-    tmp = tempfile.TemporaryFile(mode="w+")
-    runpy('-m base64 {zip_name}'.format(**locals()), stdout=tmp)
-    # now generate the include file
-    tmp.seek(0)
+    archive = _build_archive("shibokensupport", limited_api)
     with open(inc_name, "w") as inc:
-        _embed_file(tmp, inc)
-    tmp.close()
-    # also generate a simple embeddable .pyc file for signature_bootstrap.pyc
-    boot_name = "signature_bootstrap.py" if limited_api else "signature_bootstrap.pyc"
-    with open(boot_name, "rb") as ldr, open("signature_bootstrap_inc.h", "w") as inc:
-        _embed_bytefile(ldr, inc, limited_api)
+        _embed_bytes(archive, inc, textwrap.dedent("""
+            /*
+             * This is an archive of the marshalled code objects of all Python files
+             * in the directory "shiboken2/shibokenmodule/files.dir/shibokensupport".
+             * It is imported from memory by "signature_bootstrap.py".
+             */
+             """).strip())
+    # The boot loader is directly executed from C++.
+    boot_name = "signature_bootstrap.py"
+    with open(boot_name, "rb") as ldr:
+        source = ldr.read()
+    binstr = source if limited_api else _compile(source, boot_name)
+    remark = ("No code object because '--LIMITED-API=yes'" if limited_api else
+              "It is the marshalled code object")
+    with open("signature_bootstrap_inc.h", "w") as inc:
+        _embed_bytes(binstr, inc, textwrap.dedent("""
+            /*
+             * This is the file "{boot_name}" as a simple byte array.
+             * It can be directly embedded without any further processing.
+             * {remark}.
+             */
+             """).format(**locals()).strip())
     os.chdir(cur_dir)
 
 
-def _embed_file(fin, fout):
+def _compile(source, filename):
+    try:
+        return marshal.dumps(compile(source, filename, "exec", dont_inherit=True))
+    except SyntaxError as e:
+        print(e)
+        traceback.print_exc(file=sys.stdout)
+        print(textwrap.dedent("""
+            *************************************************************************
+            ***
+            *** Could not compile '{filename}'!
+            ***
+            *************************************************************************
+            """).format(**locals()))
+        raise SystemError
+
+
+def _build_archive(package, limited_api):
     """
-    Format a text file for embedding in a C++ source file.
+    Compile all modules of a package into a marshalled archive.
     """
-    # MSVC has a 64k string limitation. In C, it would be easy to create an
-    # array of 64 byte strings and use them as one big array. In C++ this does
-    # not work, since C++ insists in having the terminating nullbyte.
-    # Therefore, we split the string after an arbitrary number of lines
-    # (chunked file).
-    limit = 50
-    text = fin.readlines()
-    print(textwrap.dedent("""
-        /*
-         * This is a ZIP archive of all Python files in the directory
-         *         "shiboken2/shibokenmodule/files.dir/shibokensupport/signature"
-         * There is also a toplevel file "signature_bootstrap.py[c]" that will be
-         * directly executed from C++ as a bootstrap loader.
-         */
-         """).strip(), file=fout)
-    block, blocks = 0, len(text) // limit + 1
-    for idx, line in enumerate(text):
-        if idx % limit == 0:
-            comma = "," if block else ""
-            block += 1
-            print(file=fout)
-            print('/* Block {block} of {blocks} */{comma}'.format(**locals()), file=fout)
-        print('\"{}\"'.format(line.strip()), file=fout)
-    print('/* Sentinel */, \"\"', file=fout)
-
-
-def _embed_bytefile(fin, fout, is_text):
+    modules = {}
+    for root, dirs, files in os.walk(package):
+        dirs.sort()
+        for name in sorted(files):
+            base, ext = os.path.splitext(name)
+            # Skip scripts like 'fix-complaints.py' which cannot be imported.
+            if ext != ".py" or not base.replace("_", "a").isalnum():
+                continue
+            path = os.path.join(root, name)
+            is_package = base == "__init__"
+            parts = root.split(os.sep) + ([] if is_package else [base])
+            modname = ".".join(parts)
+            filename = "<embedded>/" + "/".join(path.split(os.sep))
+            with open(path, "rb") as f:
+                source = f.read()
+            code = _compile(source, filename)
+            modules[modname] = (is_package, filename, code,
+                                source if limited_api else None)
+    return marshal.dumps((MAGIC_NUMBER, modules))
+
+
+def _embed_bytes(binstr, fout, comment):
     """
-    Format a binary file for embedding in a C++ source file.
-    This version works directly with a single .pyc file.
+    Format binary data for embedding in a C++ source file.
+    Byte arrays are not affected by MSVC's 64k string limitation.
     """
-    fname = fin.name
-    remark = ("No .pyc file because '--LIMITED-API=yes'" if is_text else
-              "The .pyc header is stripped away")
-    print(textwrap.dedent("""
-        /*
-         * This is the file "{fname}" as a simple byte array.
-         * It can be directly embedded without any further processing.
-         * {remark}.
-         */
-         """).format(**locals()).strip(), file=fout)
-    headsize = ( 0 if is_text else
-                16 if sys.version_info >= (3, 7) else 12 if sys.version_info >= (3, 3) else 8)
-    binstr = fin.read()[headsize:]
-    if is_text:
-        try:
-            compile(binstr, fin.name, "exec")
-        except SyntaxError as e:
-            print(e)
-            traceback.print_exc(file=sys.stdout)
-            print(textwrap.dedent("""
-                *************************************************************************
-                ***
-                *** Could not compile the boot loader '{fname}'!
-                ***
-                *************************************************************************
-                """).format(version=sys.version_info[:3], **locals()))
-            raise SystemError
-    else:
-        try:
-            marshal.loads(binstr)
-        except ValueError as e:
-            print(e)
-            traceback.print_exc(file=sys.stdout)
-            print(textwrap.dedent("""
-                *************************************************************************
-                ***
-                *** This Python version {version} seems to have a new .pyc header size.
-                *** Please correct the 'headsize' constant ({headsize}).
-                ***
-                *************************************************************************
-                """).format(version=sys.version_info[:3], **locals()))
-            raise SystemError
-
+    print(comment, file=fout)
     print(file=fout)
     use_ord = sys.version_info[0] == 2
     for i in range(0, len(binstr), 16):
@@ -239,4 +216,4 @@ if __name__ == "__main__":
     args = parser.parse_args()
     if args.cmake_dir:
         work_dir = os.path.abspath(args.cmake_dir)
-    create_zipfile(args.limited_api)
+    create_archive(args.limited_api)
@@ -51,7 +51,7 @@ directly from a .pyc file.
 This file replaces the hard to read Python stub in 'signature.cpp', and we
 could distinguish better between bootstrap related functions and loader
 functions.
-It is embedded into 'signature.cpp' as "embed/signature_bootstrap.inc".
+It is embedded into 'signature_globals.cpp' as "embed/signature_bootstrap_inc.h".
 """
 
 from __future__ import print_function, absolute_import
@@ -65,7 +65,6 @@ recursion_trap = 0
 def bootstrap():
     import sys
     import os
-    import tempfile
     import traceback
     from contextlib import contextmanager
 
@@ -80,7 +79,9 @@ def bootstrap():
     def ensure_shibokensupport(support_path):
         # Make sure that we always have the shibokensupport containing package first.
         # Also remove any prior loaded module of this name, just in case.
-        sys.path.insert(0, support_path)
+        # Without a path, the modules are imported from the embedded archive.
+        if support_path:
+            sys.path.insert(0, support_path)
 
         sbks = "shibokensupport"
         if sbks in sys.modules:
@@ -100,7 +101,8 @@ def bootstrap():
                 print("  " + p)
             sys.stdout.flush()
             sys.exit(-1)
-        sys.path.remove(support_path)
+        if support_path:
+            sys.path.remove(support_path)
 
     try:
         import shiboken2 as root
@@ -119,8 +121,6 @@ def bootstrap():
     # Here we decide if we work embedded or not.
     embedding_var = "pyside_uses_embedding"
     use_embedding = bool(getattr(sys, embedding_var, False))
-    # We keep the zip file for inspection if the sys variable has been set.
-    keep_zipfile = hasattr(sys, embedding_var)
     loader_path = os.path.join(rp, look_for)
     files_dir = os.path.abspath(os.path.join(loader_path, "..", "..", ".."))
     assert files_dir.endswith("files.dir")
@@ -128,7 +128,10 @@ def bootstrap():
     # We report in sys what we used. We could put more here as well.
     if not os.path.exists(loader_path):
         use_embedding = True
-    support_path = prepare_zipfile() if use_embedding else files_dir
+    if use_embedding:
+        # The importer stays installed, since some modules are imported on demand.
+        sys.meta_path.insert(0, EmbeddedImporter(module_archive))
+    support_path = None if use_embedding else files_dir
     setattr(sys, embedding_var, use_embedding)
 
     try:
@@ -140,44 +143,76 @@ def bootstrap():
         traceback.print_exc(file=sys.stdout)
 
     finally:
-        if use_embedding and not keep_zipfile:
-            # clear the temp zipfile
-            try:
-                os.remove(support_path)
-            except OSError as e:
-                print(e)
-                print("Error deleting {support_path}, ignored".format(**locals()))
         return loader
 
-# New functionality: Loading from a zip archive.
-# There exists the zip importer, but as it is written, only real zip files are
-# supported. Before I will start an own implementation, it is easiest to use
-# a temporary zip file.
+# New functionality: Loading from an archive in memory.
+# The archive is created by 'embedding_generator.py' and contains the
+# marshalled code objects of the modules, so neither a zip file needs to be
+# unpacked nor a source file to be compiled.
 
-def prepare_zipfile():
+class EmbeddedImporter(object):
     """
-    Write the zip file to a real file and return its name.
-    It will be implicitly opened as such when we add the name to sys.path .
+    Meta path finder and loader for the modules of the embedded archive.
+    It supports the protocol of Python 3.4+ and the one of Python 2.
     """
-    import base64
-    import tempfile
-    import os
-    import zipfile
-
-    # 'zipstring_sequence' comes from signature.cpp
-    zipbytes = base64.b64decode(''.join(zipstring_sequence))
-    fd, fname = tempfile.mkstemp(prefix='embedded.', suffix='.zip')
-    os.write(fd, zipbytes)
-    os.close(fd)
-    # Let us test the zipfile if it really is one.
-    # Otherwise, zipimporter would simply ignore it without notice.
-    try:
-        z = zipfile.ZipFile(fname)
-        z.close()
-    except zipfile.BadZipFile as e:
-        print('Broken Zip File:', e)
-        traceback.print_exc(file=sys.stdout)
-    finally:
-        return fname
+    def __init__(self, archive):
+        import marshal
+        try:
+            from importlib.util import MAGIC_NUMBER
+        except ImportError:
+            from imp import get_magic
+            MAGIC_NUMBER = get_magic()
+        # 'module_archive' comes from signature_globals.cpp
+        magic, self.modules = marshal.loads(archive)
+        self.compiled = magic == MAGIC_NUMBER
+
+    def get_code(self, fullname):
+        import marshal
+        is_package, filename, code, source = self.modules[fullname]
+        if self.compiled:
+            return marshal.loads(code)
+        if source is None:
+            raise ImportError("The embedded module {} was compiled for a different "
+                              "Python version".format(fullname))
+        return compile(source, filename, "exec", dont_inherit=True)
+
+    def is_package(self, fullname):
+        return self.modules[fullname][0]
+
+    # Python 3.4+
+    def find_spec(self, fullname, path=None, target=None):
+        if fullname not in self.modules:
+            return None
+        from importlib.machinery import ModuleSpec
+        return ModuleSpec(fullname, self, origin=self.modules[fullname][1],
+                          is_package=self.is_package(fullname))
+
+    def create_module(self, spec):
+        return None
+
+    def exec_module(self, module):
+        exec(self.get_code(module.__spec__.name), module.__dict__)
+
+    # Python 2
+    def find_module(self, fullname, path=None):
+        return self if fullname in self.modules else None
+
+    def load_module(self, fullname):
+        import sys
+        import types
+        module = sys.modules.setdefault(fullname, types.ModuleType(fullname))
+        module.__loader__ = self
+        module.__file__ = self.modules[fullname][1]
+        if self.is_package(fullname):
+            module.__path__ = []
+            module.__package__ = fullname
+        else:
+            module.__package__ = fullname.rpartition(".")[0]
+        try:
+            exec(self.get_code(fullname), module.__dict__)
+        except BaseException:
+            del sys.modules[fullname]
+            raise
+        return module
 
 # eof
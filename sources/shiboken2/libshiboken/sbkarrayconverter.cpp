@@ -42,9 +42,13 @@
 #include "helper.h"
 #include "sbkconverter.h"
 #include "sbkconverter_p.h"
+#include "shibokenbuffer.h"
 
 #include <longobject.h>
 #include <floatobject.h>
+#if !defined(Py_LIMITED_API) && PY_VERSION_HEX < 0x030B0000
+#  include <longintrepr.h>
+#endif
 
 #include <algorithm>
 
@@ -53,14 +57,43 @@ static SbkArrayConverter *ArrayTypeConverters[Shiboken::Conversions::SBK_ARRAY_I
 namespace Shiboken {
 namespace Conversions {
 
-// Check whether Predicate is true for all elements of a sequence
-template <class Predicate>
-static bool sequenceAllOf(PyObject *pyIn, Predicate p)
+// Call Function for all elements of a sequence until it returns false.
+// Lists and tuples are accessed directly without creating references.
+template <class Function>
+static bool sequenceForEach(PyObject *pyIn, Function f)
 {
+#ifndef Py_LIMITED_API
+    if (PyList_CheckExact(pyIn) || PyTuple_CheckExact(pyIn)) {
+        PyObject **items = PySequence_Fast_ITEMS(pyIn);
+        const Py_ssize_t size = PySequence_Fast_GET_SIZE(pyIn);
+        for (Py_ssize_t i = 0; i < size; ++i) {
+            if (!f(items[i]))
+                return false;
+        }
+        return true;
+    }
+#else
+    if (PyList_CheckExact(pyIn)) {
+        const Py_ssize_t size = PyList_Size(pyIn);
+        for (Py_ssize_t i = 0; i < size; ++i) {
+            if (!f(PyList_GetItem(pyIn, i)))
+                return false;
+        }
+        return true;
+    }
+    if (PyTuple_CheckExact(pyIn)) {
+        const Py_ssize_t size = PyTuple_Size(pyIn);
+        for (Py_ssize_t i = 0; i < size; ++i) {
+            if (!f(PyTuple_GetItem(pyIn, i)))
+                return false;
+        }
+        return true;
+    }
+#endif // Py_LIMITED_API
     const Py_ssize_t size = PySequence_Size(pyIn);
     for (Py_ssize_t i = 0; i < size; ++i) {
         PyObject *item = PySequence_GetItem(pyIn, i);
-        const bool ok = p(item);
+        const bool ok = f(item);
         Py_XDECREF(item);
         if (!ok)
             return false;
@@ -68,16 +101,48 @@ static bool sequenceAllOf(PyObject *pyIn, Predicate p)
     return true;
 }
 
+// Check whether Predicate is true for all elements of a sequence
+template <class Predicate>
+static inline bool sequenceAllOf(PyObject *pyIn, Predicate p)
+{
+    return sequenceForEach(pyIn, p);
+}
+
 // Convert a sequence to output iterator
 template <class T, class Converter>
 inline void convertPySequence(PyObject *pyIn, Converter c, T *out)
 {
-    const Py_ssize_t size = PySequence_Size(pyIn);
-    for (Py_ssize_t i = 0; i < size; ++i) {
-        PyObject *item = PySequence_GetItem(pyIn, i);
+    sequenceForEach(pyIn, [c, &out](PyObject *item) {
         *out++ = c(item);
-        Py_XDECREF(item);
-    }
+        return true;
+    });
+}
+
+// Buffers (array.array, memoryview, NumPy) of the struct format matching the
+// C++ type are copied in one go instead of converting item by item.
+template <class T> struct ArrayBufferFormat;
+template <> struct ArrayBufferFormat<short> { static const char *format() { return "h"; } };
+template <> struct ArrayBufferFormat<unsigned short> { static const char *format() { return "H"; } };
+template <> struct ArrayBufferFormat<int> { static const char *format() { return "i"; } };
+template <> struct ArrayBufferFormat<unsigned> { static const char *format() { return "I"; } };
+template <> struct ArrayBufferFormat<long long> { static const char *format() { return "q"; } };
+template <> struct ArrayBufferFormat<unsigned long long> { static const char *format() { return "Q"; } };
+template <> struct ArrayBufferFormat<float> { static const char *format() { return "f"; } };
+template <> struct ArrayBufferFormat<double> { static const char *format() { return "d"; } };
+
+template <class T>
+static inline Py_ssize_t bufferArraySize(PyObject *pyIn)
+{
+    return Buffer::itemCount(pyIn, ArrayBufferFormat<T>::format(), Py_ssize_t(sizeof(T)));
+}
+
+template <class T>
+static void bufferToCppArray(PyObject *pyIn, void *cppOut)
+{
+    auto *handle = reinterpret_cast<ArrayHandle<T> *>(cppOut);
+    const Py_ssize_t size = bufferArraySize<T>(pyIn);
+    handle->allocate(size);
+    Buffer::copyData(pyIn, handle->data(), size * Py_ssize_t(sizeof(T)));
 }
 
 // Internal, for usage by numpy
@@ -100,6 +165,30 @@ SbkArrayConverter *unimplementedArrayConverter()
     return result;
 }
 
+static inline bool sequenceSizeCheck(Py_ssize_t size, int expectedSize = -1)
+{
+    if (expectedSize >= 0 && size < expectedSize) {
+        warning(PyExc_RuntimeWarning, 0, "A sequence of size %d was passed to a function that expects %d.",
+                int(size), expectedSize);
+        return false;
+    }
+    return true;
+}
+
+// Check for a buffer of matching format or a sequence of elements passing
+// ItemCheck and return the respective conversion function.
+template <class T, bool (*ItemCheck)(PyObject *)>
+static PythonToCppFunc arrayCheck(PyObject *pyIn, int expectedSize,
+                                  PythonToCppFunc sequenceToCpp)
+{
+    const Py_ssize_t bufferSize = bufferArraySize<T>(pyIn);
+    if (bufferSize >= 0)
+        return sequenceSizeCheck(bufferSize, expectedSize) ? bufferToCppArray<T> : nullptr;
+    return PySequence_Check(pyIn) && sequenceAllOf(pyIn, ItemCheck)
+        && sequenceSizeCheck(PySequence_Size(pyIn), expectedSize)
+        ? sequenceToCpp : nullptr;
+}
+
 // Integers
 
 static inline bool intCheck(PyObject *pyIn)
@@ -111,40 +200,58 @@ static inline bool intCheck(PyObject *pyIn)
 #endif
 }
 
-static short toShort(PyObject *pyIn) { return short(PyLong_AsLong(pyIn)); }
-
-static void sequenceToCppShortArray(PyObject *pyIn, void *cppOut)
+// Read an exact int of a single digit (below 2**30, or 2**15 with 15 bit
+// digits) without a call into Python. The layout of PyLongObject is not part
+// of the limited API and changed in Python 3.12.
+static inline bool smallIntValue(PyObject *pyIn, long *value)
 {
-    auto *handle = reinterpret_cast<ArrayHandle<short> *>(cppOut);
-    handle->allocate(PySequence_Size(pyIn));
-    convertPySequence(pyIn, toShort, handle->data());
+#if !defined(Py_LIMITED_API) && PY_VERSION_HEX < 0x030C0000
+    if (PyLong_CheckExact(pyIn)) {
+        auto *longObject = reinterpret_cast<PyLongObject *>(pyIn);
+        switch (Py_SIZE(longObject)) {
+        case -1:
+            *value = -long(longObject->ob_digit[0]);
+            return true;
+        case 0:
+            *value = 0;
+            return true;
+        case 1:
+            *value = long(longObject->ob_digit[0]);
+            return true;
+        }
+    }
+#else
+    SBK_UNUSED(pyIn)
+    SBK_UNUSED(value)
+#endif
+    return false;
 }
 
-static inline bool sequenceSizeCheck(PyObject *pyIn, int expectedSize = -1)
+static short toShort(PyObject *pyIn)
 {
-    if (expectedSize >= 0) {
-        const int size = int(PySequence_Size(pyIn));
-        if (size < expectedSize) {
-            warning(PyExc_RuntimeWarning, 0, "A sequence of size %d was passed to a function that expects %d.",
-                   size, expectedSize);
-            return false;
-        }
-    }
-    return true;
+    long value;
+    return short(smallIntValue(pyIn, &value) ? value : PyLong_AsLong(pyIn));
 }
 
-static inline bool intArrayCheck(PyObject *pyIn, int expectedSize = -1)
+static void sequenceToCppShortArray(PyObject *pyIn, void *cppOut)
 {
-    return PySequence_Check(pyIn) && sequenceAllOf(pyIn, intCheck)
-        && sequenceSizeCheck(pyIn, expectedSize);
+    auto *handle = reinterpret_cast<ArrayHandle<short> *>(cppOut);
+    handle->allocate(PySequence_Size(pyIn));
+    convertPySequence(pyIn, toShort, handle->data());
 }
 
 static PythonToCppFunc sequenceToCppShortArrayCheck(PyObject *pyIn, int dim1, int /* dim2 */)
 {
-    return intArrayCheck(pyIn, dim1) ? sequenceToCppShortArray : nullptr;
+    return arrayCheck<short, intCheck>(pyIn, dim1, sequenceToCppShortArray);
 }
 
-static short toUnsignedShort(PyObject *pyIn) { return static_cast<unsigned short>(PyLong_AsUnsignedLong(pyIn)); }
+static unsigned short toUnsignedShort(PyObject *pyIn)
+{
+    long value;
+    if (smallIntValue(pyIn, &value) && value >= 0)
+        return static_cast<unsigned short>(value);
+    return static_cast<unsigned short>(PyLong_AsUnsignedLong(pyIn));
+}
 
 static void sequenceToCppUnsignedShortArray(PyObject *pyIn, void *cppOut)
 {
@@ -155,75 +262,106 @@ static void sequenceToCppUnsignedShortArray(PyObject *pyIn, void *cppOut)
 
 static PythonToCppFunc sequenceToCppUnsignedShortArrayCheck(PyObject *pyIn, int dim1, int /* dim2 */)
 {
-    return intArrayCheck(pyIn, dim1) ? sequenceToCppUnsignedShortArray : nullptr;
+    return arrayCheck<unsigned short, intCheck>(pyIn, dim1, sequenceToCppUnsignedShortArray);
+}
+
+static int toInt(PyObject *pyIn)
+{
+    long value;
+    return smallIntValue(pyIn, &value) ? int(value) : _PepLong_AsInt(pyIn);
 }
 
 static void sequenceToCppIntArray(PyObject *pyIn, void *cppOut)
 {
     auto *handle = reinterpret_cast<ArrayHandle<int> *>(cppOut);
     handle->allocate(PySequence_Size(pyIn));
-    convertPySequence(pyIn, _PepLong_AsInt, handle->data());
+    convertPySequence(pyIn, toInt, handle->data());
 }
 
 static PythonToCppFunc sequenceToCppIntArrayCheck(PyObject *pyIn, int dim1, int /* dim2 */)
 {
-    return intArrayCheck(pyIn, dim1) ? sequenceToCppIntArray : nullptr;
+    return arrayCheck<int, intCheck>(pyIn, dim1, sequenceToCppIntArray);
+}
+
+static unsigned toUnsigned(PyObject *pyIn)
+{
+    long value;
+    if (smallIntValue(pyIn, &value) && value >= 0)
+        return unsigned(value);
+    return unsigned(PyLong_AsUnsignedLong(pyIn));
 }
 
 static void sequenceToCppUnsignedArray(PyObject *pyIn, void *cppOut)
 {
     auto *handle = reinterpret_cast<ArrayHandle<unsigned> *>(cppOut);
     handle->allocate(PySequence_Size(pyIn));
-    convertPySequence(pyIn, PyLong_AsUnsignedLong, handle->data());
+    convertPySequence(pyIn, toUnsigned, handle->data());
 }
 
 static PythonToCppFunc sequenceToCppUnsignedArrayCheck(PyObject *pyIn, int dim1, int /* dim2 */)
 {
-    return intArrayCheck(pyIn, dim1) ? sequenceToCppUnsignedArray : nullptr;
+    return arrayCheck<unsigned, intCheck>(pyIn, dim1, sequenceToCppUnsignedArray);
+}
+
+static long long toLongLong(PyObject *pyIn)
+{
+    long value;
+    return smallIntValue(pyIn, &value) ? value : PyLong_AsLongLong(pyIn);
 }
 
 static void sequenceToCppLongLongArray(PyObject *pyIn, void *cppOut)
 {
     auto *handle = reinterpret_cast<ArrayHandle<long long> *>(cppOut);
     handle->allocate(PySequence_Size(pyIn));
-    convertPySequence(pyIn, PyLong_AsLongLong, handle->data());
+    convertPySequence(pyIn, toLongLong, handle->data());
 }
 
 static PythonToCppFunc sequenceToCppLongLongArrayCheck(PyObject *pyIn, int dim1, int /* dim2 */)
 {
-    return intArrayCheck(pyIn, dim1) ? sequenceToCppLongLongArray : nullptr;
+    return arrayCheck<long long, intCheck>(pyIn, dim1, sequenceToCppLongLongArray);
+}
+
+static unsigned long long toUnsignedLongLong(PyObject *pyIn)
+{
+    long value;
+    if (smallIntValue(pyIn, &value) && value >= 0)
+        return static_cast<unsigned long long>(value);
+    return PyLong_AsUnsignedLongLong(pyIn);
 }
 
 static void sequenceToCppUnsignedLongLongArray(PyObject *pyIn, void *cppOut)
 {
     auto *handle = reinterpret_cast<ArrayHandle<unsigned long long> *>(cppOut);
     handle->allocate(PySequence_Size(pyIn));
-    convertPySequence(pyIn, PyLong_AsUnsignedLongLong, handle->data());
+    convertPySequence(pyIn, toUnsignedLongLong, handle->data());
 }
 
 static PythonToCppFunc sequenceToCppUnsignedLongLongArrayCheck(PyObject *pyIn, int dim1, int /* dim2 */)
 {
-    return intArrayCheck(pyIn, dim1) ? sequenceToCppUnsignedLongLongArray : nullptr;
+    return arrayCheck<unsigned long long, intCheck>(pyIn, dim1, sequenceToCppUnsignedLongLongArray);
 }
 
 // Float
 
 static inline bool floatCheck(PyObject *pyIn) { return PyFloat_Check(pyIn); }
 
-static inline bool floatArrayCheck(PyObject *pyIn, int expectedSize = -1)
+static inline double pyToDouble(PyObject *pyIn)
 {
-    return PySequence_Check(pyIn) && sequenceAllOf(pyIn, floatCheck)
-        && sequenceSizeCheck(pyIn, expectedSize);
+#ifndef Py_LIMITED_API
+    if (PyFloat_CheckExact(pyIn))
+        return PyFloat_AS_DOUBLE(pyIn);
+#endif
+    return PyFloat_AsDouble(pyIn);
 }
 
 static void sequenceToCppDoubleArray(PyObject *pyIn, void *cppOut)
 {
     auto *handle = reinterpret_cast<ArrayHandle<double> *>(cppOut);
     handle->allocate(PySequence_Size(pyIn));
-    convertPySequence(pyIn, PyFloat_AsDouble, handle->data());
+    convertPySequence(pyIn, pyToDouble, handle->data());
 }
 
-static inline float pyToFloat(PyObject *pyIn) { return float(PyFloat_AsDouble(pyIn)); }
+static inline float pyToFloat(PyObject *pyIn) { return float(pyToDouble(pyIn)); }
 
 static void sequenceToCppFloatArray(PyObject *pyIn, void *cppOut)
 {
@@ -234,12 +372,12 @@ static void sequenceToCppFloatArray(PyObject *pyIn, void *cppOut)
 
 static PythonToCppFunc sequenceToCppFloatArrayCheck(PyObject *pyIn, int dim1, int /* dim2 */)
 {
-    return floatArrayCheck(pyIn, dim1) ? sequenceToCppFloatArray : nullptr;
+    return arrayCheck<float, floatCheck>(pyIn, dim1, sequenceToCppFloatArray);
 }
 
 static PythonToCppFunc sequenceToCppDoubleArrayCheck(PyObject *pyIn, int dim1, int /* dim2 */)
 {
-    return floatArrayCheck(pyIn, dim1) ? sequenceToCppDoubleArray : nullptr;
+    return arrayCheck<double, floatCheck>(pyIn, dim1, sequenceToCppDoubleArray);
 }
 
 #ifdef HAVE_NUMPY
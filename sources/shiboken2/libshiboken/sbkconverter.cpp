@@ -44,15 +44,43 @@
 #include "bindingmanager.h"
 #include "autodecref.h"
 #include "sbkdbg.h"
+#include "sbkmodule.h"
 #include "helper.h"
 #include "voidptr.h"
 
+#include <cstring>
+#include <forward_list>
+#include <string>
 #include <unordered_map>
 
 static SbkConverter **PrimitiveTypeConverters;
 
-using ConvertersMap = std::unordered_map<std::string, SbkConverter *>;
+// The converter names are referenced, not copied. Most of them are string
+// literals of the generated modules living in read-only memory which is
+// shared between processes. Names of unknown lifetime are kept in ownedNames.
+struct ConverterNameHash
+{
+    std::size_t operator()(const char *name) const
+    {
+        std::size_t result = 2166136261u;   // FNV-1a
+        for (; *name != '\0'; ++name)
+            result = (result ^ static_cast<unsigned char>(*name)) * 16777619u;
+        return result;
+    }
+};
+
+struct ConverterNameEqual
+{
+    bool operator()(const char *lhs, const char *rhs) const
+    {
+        return std::strcmp(lhs, rhs) == 0;
+    }
+};
+
+using ConvertersMap = std::unordered_map<const char *, SbkConverter *,
+                                         ConverterNameHash, ConverterNameEqual>;
 static ConvertersMap converters;
+static std::forward_list<std::string> ownedNames;
 
 namespace Shiboken {
 namespace Conversions {
@@ -159,6 +187,11 @@ void setCppPointerToPythonFunction(SbkConverter *converter, CppToPythonFunc poin
     converter->pointerToPython = pointerToPythonFunc;
 }
 
+void setCppMoveToPythonFunction(SbkConverter *converter, CppToPythonFunc moveToPythonFunc)
+{
+    converter->moveToPython = moveToPythonFunc;
+}
+
 void setPythonToCppPointerFunctions(SbkConverter *converter,
                                     PythonToCppFunc toCppPointerConvFunc,
                                     IsConvertibleToCppFunc toCppPointerCheckFunc)
@@ -239,6 +272,18 @@ PyObject *copyToPython(const SbkConverter *converter, const void *cppIn)
     return CopyCppToPython(converter, cppIn);
 }
 
+PyObject *moveToPython(SbkObjectType *type, void *cppIn)
+{
+    return moveToPython(PepType_SOTP(type)->converter, cppIn);
+}
+
+PyObject *moveToPython(const SbkConverter *converter, void *cppIn)
+{
+    if (cppIn && converter->moveToPython)
+        return converter->moveToPython(cppIn);
+    return CopyCppToPython(converter, cppIn);
+}
+
 PythonToCppFunc isPythonToCppPointerConvertible(SbkObjectType *type, PyObject *pyIn)
 {
     assert(pyIn);
@@ -368,8 +413,19 @@ bool isImplicitConversion(SbkObjectType *type, PythonToCppFunc toCppFunc)
 void registerConverterName(SbkConverter *converter , const char *typeName)
 {
     auto iter = converters.find(typeName);
-    if (iter == converters.end())
-        converters.insert(std::make_pair(typeName, converter));
+    if (iter == converters.end()) {
+        ownedNames.emplace_front(typeName);
+        converters.insert(std::make_pair(ownedNames.front().c_str(), converter));
+    }
+}
+
+void registerConverterNames(SbkConverter *converter, const char *typeNames)
+{
+    for (const char *typeName = typeNames; *typeName != '\0';
+         typeName += std::strlen(typeName) + 1) {
+        // emplace() does not replace an existing entry.
+        converters.emplace(typeName, converter);
+    }
 }
 
 SbkConverter *getConverter(const char *typeName)
@@ -377,6 +433,12 @@ SbkConverter *getConverter(const char *typeName)
     ConvertersMap::const_iterator it = converters.find(typeName);
     if (it != converters.end())
         return it->second;
+    // The type may not have been created yet (lazy type initialization).
+    if (Module::createLazyTypeByName(typeName)) {
+        it = converters.find(typeName);
+        if (it != converters.end())
+            return it->second;
+    }
     if (Py_VerboseFlag > 0)
         SbkDbg() << "Can't find type resolver for type '" << typeName << "'.";
     return nullptr;
@@ -166,6 +166,9 @@ LIBSHIBOKEN_API void deleteConverter(SbkConverter *converter);
 /// Sets the Python object to C++ pointer conversion function.
 LIBSHIBOKEN_API void setCppPointerToPythonFunction(SbkConverter *converter, CppToPythonFunc pointerToPythonFunc);
 
+/// Sets the function moving a C++ value into a new Python wrapper (see moveToPython()).
+LIBSHIBOKEN_API void setCppMoveToPythonFunction(SbkConverter *converter, CppToPythonFunc moveToPythonFunc);
+
 /// Sets the C++ pointer to Python object conversion functions.
 LIBSHIBOKEN_API void setPythonToCppPointerFunctions(SbkConverter *converter,
                                                     PythonToCppFunc toCppPointerConvFunc,
@@ -216,6 +219,18 @@ LIBSHIBOKEN_API PyObject *referenceToPython(const SbkConverter *converter, const
 LIBSHIBOKEN_API PyObject *copyToPython(SbkObjectType *type, const void *cppIn);
 LIBSHIBOKEN_API PyObject *copyToPython(const SbkConverter *converter, const void *cppIn);
 
+/**
+ *  Like copyToPython(), but moves the C++ value pointed by \p cppIn into
+ *  the new Python wrapper, leaving \p cppIn in a moved-from state. Falls
+ *  back to copying for types without a move conversion.
+ *  This function is used only for Value Types.
+ *  Example usage:
+ *      TYPE var = function();
+ *      PyObject *pyVar = moveToPython(SBKTYPE, &var);
+ */
+LIBSHIBOKEN_API PyObject *moveToPython(SbkObjectType *type, void *cppIn);
+LIBSHIBOKEN_API PyObject *moveToPython(const SbkConverter *converter, void *cppIn);
+
 // Python -> C++ ---------------------------------------------------------------------------
 
 /**
@@ -276,6 +291,13 @@ LIBSHIBOKEN_API bool isImplicitConversion(SbkObjectType *type, PythonToCppFunc t
 /// Registers a converter with a type name that may be used to retrieve the converter.
 LIBSHIBOKEN_API void registerConverterName(SbkConverter *converter, const char *typeName);
 
+/**
+ *  Registers a converter with several type names. \p typeNames contains the names
+ *  separated by '\0' and is terminated by an empty name, like "int\0" "int*\0".
+ *  The names are not copied, \p typeNames must be static (usually a string literal).
+ */
+LIBSHIBOKEN_API void registerConverterNames(SbkConverter *converter, const char *typeNames);
+
 /// Returns the converter for a given type name, or NULL if it wasn't registered before.
 LIBSHIBOKEN_API SbkConverter *getConverter(const char *typeName);
 
@@ -87,6 +87,14 @@ struct SbkConverter
      *  wrapper assigned for it.
      */
     CppToPythonFunc copyToPython;
+    /**
+     *  This function converts a C++ object to a Python object of the type
+     *  indicated in pythonType by moving it into a new instance of the
+     *  C++ object. The source object is left in a moved-from state.
+     *  It is used for values returned by functions and is optional;
+     *  copyToPython is used when it is not set.
+     */
+    CppToPythonFunc moveToPython = nullptr;
     /**
      *  This is a special case of a Python to C++ conversion. It returns
      *  the underlying C++ pointer of a Python wrapper passed as parameter
@@ -154,11 +162,24 @@ template<typename T, typename MaxLimitType = PY_LONG_LONG,
                      bool isSigned = std::numeric_limits<T>::is_signed >
 struct OverFlowChecker;
 
+// The checks take a fast path for values in range which are not the error
+// return value (-1) of PyLong_AsLongLong() and friends, so that neither the
+// Python error indicator nor the overflow message are touched on success.
 template<typename T, typename MaxLimitType>
 struct OverFlowChecker<T, MaxLimitType, true> :
         public OverFlowCheckerBase<T, MaxLimitType, true> {
+    // Shifting by the minimum maps the range of T onto [0, max - min],
+    // which is checked by a single unsigned comparison.
+    static bool isInRange(const MaxLimitType &value)
+    {
+        using Unsigned = unsigned PY_LONG_LONG;
+        return Unsigned(value) - Unsigned(std::numeric_limits<T>::min())
+            <= Unsigned(std::numeric_limits<T>::max()) - Unsigned(std::numeric_limits<T>::min());
+    }
     static bool check(const MaxLimitType &value, PyObject *pyIn)
     {
+        if (value != MaxLimitType(-1) && isInRange(value))
+            return false;
         std::string valueAsString;
         const bool isOverflow =
             OverFlowChecker::checkForInternalPyOverflow(pyIn, valueAsString)
@@ -173,8 +194,15 @@ struct OverFlowChecker<T, MaxLimitType, true> :
 template<typename T, typename MaxLimitType>
 struct OverFlowChecker<T, MaxLimitType, false>
         : public OverFlowCheckerBase<T, MaxLimitType, false> {
+    static bool isInRange(const MaxLimitType &value)
+    {
+        return (value >= 0)
+            & (static_cast<unsigned PY_LONG_LONG>(value) <= std::numeric_limits<T>::max());
+    }
     static bool check(const MaxLimitType &value, PyObject *pyIn)
     {
+        if (value != MaxLimitType(-1) && isInRange(value))
+            return false;
         std::string valueAsString;
         const bool isOverflow =
             OverFlowChecker::checkForInternalPyOverflow(pyIn, valueAsString)
@@ -189,6 +217,8 @@ template<>
 struct OverFlowChecker<PY_LONG_LONG, PY_LONG_LONG, true> :
         public OverFlowCheckerBase<PY_LONG_LONG, PY_LONG_LONG, true> {
     static bool check(const PY_LONG_LONG &value, PyObject *pyIn) {
+        if (value != -1)
+            return false;
         std::string valueAsString;
         const bool isOverflow = checkForInternalPyOverflow(pyIn, valueAsString);
         if (isOverflow)
@@ -266,6 +296,9 @@ struct IntPrimitive : TwoPrimitive<INT>
     }
     static PythonToCppFunc isConvertible(PyObject *pyIn)
     {
+        // Exact integers are the common case, do not probe them for floats first.
+        if (PyInt_CheckExact(pyIn))
+            return otherToCpp;
         if (PyFloat_Check(pyIn))
             return toCpp;
         return nullptr;
@@ -383,8 +416,14 @@ struct FloatPrimitive : TwoPrimitive<FLOAT>
     {
         *reinterpret_cast<FLOAT *>(cppOut) = FLOAT(PyLong_AsLong(pyIn));
     }
+    static void exactFloatToCpp(PyObject *pyIn, void *cppOut)
+    {
+        *reinterpret_cast<FLOAT *>(cppOut) = FLOAT(PyFloat_AS_DOUBLE(pyIn));
+    }
     static PythonToCppFunc isConvertible(PyObject *pyIn)
     {
+        if (PyFloat_CheckExact(pyIn))
+            return exactFloatToCpp;
         if (PyInt_Check(pyIn) || PyLong_Check(pyIn))
             return toCpp;
         return nullptr;
@@ -414,10 +453,16 @@ struct Primitive<bool> : OnePrimitive<bool>
     }
     static PythonToCppFunc isConvertible(PyObject *pyIn)
     {
+        if (PyBool_Check(pyIn))
+            return boolToCpp;
         if (SbkNumber_Check(pyIn))
             return toCpp;
         return nullptr;
     }
+    static void boolToCpp(PyObject *pyIn, void *cppOut)
+    {
+        *reinterpret_cast<bool *>(cppOut) = pyIn == Py_True;
+    }
     static void toCpp(PyObject *pyIn, void *cppOut)
     {
         *reinterpret_cast<bool *>(cppOut) = PyInt_AS_LONG(pyIn) != 0;
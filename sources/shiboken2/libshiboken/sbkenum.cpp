@@ -48,7 +48,9 @@
 #include "sbkpython.h"
 
 #include <string.h>
+#include <algorithm>
 #include <cstring>
+#include <unordered_map>
 #include <vector>
 
 #define SBK_ENUM(ENUM) reinterpret_cast<SbkEnumObject *>(ENUM)
@@ -58,13 +60,35 @@ typedef PyObject *(*enum_func)(PyObject *, PyObject *);
 extern "C"
 {
 
+struct SbkEnumItemTable;
+
 struct SbkEnumTypePrivate
 {
     SbkConverter **converterPtr;
     SbkConverter *converter;
     const char *cppName;
+    // Note: The private data is placed behind the heap type allocated by
+    // SbkType_FromSpec(), which leaves room for a PyMemberDef only.
+    SbkEnumItemTable *itemTable;
+};
+
+/// The items of an enum set by Shiboken::Enum::setEnumItems().
+struct SbkEnumItemTable
+{
+    const Shiboken::Enum::EnumItem *items;
+    int count;
+    std::vector<PyObject *> objects;    // created on first access
+    std::vector<int> byValue;           // only needed if the table is not sorted
+    std::vector<int> byName;            // created on first lookup by name
+    bool complete;                      // all objects were created
 };
 
+/// Maps Shiboken types to the enums they enclose whose items are not yet all
+/// inserted into the type dict.
+using PendingScopeMap = std::unordered_map<PyTypeObject *, std::vector<PyTypeObject *> >;
+
+static PendingScopeMap pendingScopes;
+
 struct SbkEnumType
 {
     PyTypeObject type;
@@ -77,6 +101,94 @@ struct SbkEnumObject
     PyObject *ob_name;
 };
 
+static SbkEnumItemTable *itemTable(PyTypeObject *enumType)
+{
+    return PepType_SETP(reinterpret_cast<SbkEnumType *>(enumType))->itemTable;
+}
+
+// Returns a borrowed reference to the item at \p index, creating it if needed.
+static PyObject *itemObject(PyTypeObject *enumType, SbkEnumItemTable *table, int index)
+{
+    PyObject *&object = table->objects[index];
+    if (object != nullptr)
+        return object;
+    const Shiboken::Enum::EnumItem &item = table->items[index];
+    auto *enumObj = PyObject_New(SbkEnumObject, enumType);
+    if (enumObj == nullptr)
+        return nullptr;
+    enumObj->ob_name = PyBytes_FromString(item.name);
+    enumObj->ob_value = item.value;
+    auto *result = reinterpret_cast<PyObject *>(enumObj);
+    if (PyDict_SetItemString(enumType->tp_dict, item.name, result) < 0) {
+        Py_DECREF(result);
+        return nullptr;
+    }
+    PyType_Modified(enumType);
+    object = result;    // The table keeps the reference.
+    return object;
+}
+
+static int findItemByValue(const SbkEnumItemTable *table, long value)
+{
+    // Returns the first item in case of aliases like the former lookup in "values".
+    if (table->byValue.empty()) {
+        auto end = table->items + table->count;
+        auto it = std::lower_bound(table->items, end, value,
+                                   [](const Shiboken::Enum::EnumItem &item, long v) {
+                                       return item.value < v;
+                                   });
+        return it != end && it->value == value ? int(it - table->items) : -1;
+    }
+    auto it = std::lower_bound(table->byValue.cbegin(), table->byValue.cend(), value,
+                               [table](int i, long v) { return table->items[i].value < v; });
+    return it != table->byValue.cend() && table->items[*it].value == value ? *it : -1;
+}
+
+static int findItemByName(SbkEnumItemTable *table, const char *name)
+{
+    auto less = [table](int i, const char *n) { return std::strcmp(table->items[i].name, n) < 0; };
+    if (table->byName.empty()) {
+        table->byName.resize(table->count);
+        for (int i = 0; i < table->count; ++i)
+            table->byName[i] = i;
+        std::sort(table->byName.begin(), table->byName.end(), [table](int a, int b) {
+            return std::strcmp(table->items[a].name, table->items[b].name) < 0;
+        });
+    }
+    auto it = std::lower_bound(table->byName.cbegin(), table->byName.cend(), name, less);
+    return it != table->byName.cend() && std::strcmp(table->items[*it].name, name) == 0 ? *it : -1;
+}
+
+// Returns the indexes of the table items in the order of their declaration.
+static std::vector<int> declarationOrder(const SbkEnumItemTable *table)
+{
+    std::vector<int> result(table->count);
+    for (int i = 0; i < table->count; ++i)
+        result[table->items[i].index] = i;
+    return result;
+}
+
+// Creates all items and the "values" dict of an enum type with an item table.
+static bool createAllItems(PyTypeObject *enumType, SbkEnumItemTable *table)
+{
+    if (table->complete)
+        return true;
+    Shiboken::AutoDecRef values(PyDict_New());
+    if (values.isNull())
+        return false;
+    // "values" keeps the declaration order of the items.
+    for (int i : declarationOrder(table)) {
+        PyObject *item = itemObject(enumType, table, i);
+        if (item == nullptr || PyDict_SetItemString(values, table->items[i].name, item) < 0)
+            return false;
+    }
+    if (PyDict_SetItem(enumType->tp_dict, Shiboken::PyName::values(), values) < 0)
+        return false;
+    PyType_Modified(enumType);
+    table->complete = true;
+    return true;
+}
+
 static PyObject *SbkEnumObject_repr(PyObject *self)
 {
     const SbkEnumObject *enumObj = SBK_ENUM(self);
@@ -280,10 +392,23 @@ static PyObject *SbkEnumType_repr(PyObject *type)
 #endif // PY_VERSION_HEX < 0x03000000
 
 static void SbkEnumTypeDealloc(PyObject *pyObj);
+static int SbkEnumType_traverse(PyObject *type, visitproc visit, void *arg);
+static int SbkEnumType_clear(PyObject *type);
 static PyObject *SbkEnumTypeTpNew(PyTypeObject *metatype, PyObject *args, PyObject *kwds);
+static PyObject *SbkEnumType_getattro(PyObject *type, PyObject *name);
+static PyObject *SbkEnumType_get___dict__(PyObject *type, void *);
+
+static PyGetSetDef SbkEnumType_getsetlist[] = {
+    {const_cast<char *>("__dict__"), SbkEnumType_get___dict__, nullptr, nullptr, nullptr},
+    {nullptr, nullptr, nullptr, nullptr, nullptr} // Sentinel
+};
 
 static PyType_Slot SbkEnumType_Type_slots[] = {
     {Py_tp_dealloc, (void *)SbkEnumTypeDealloc},
+    {Py_tp_traverse, (void *)SbkEnumType_traverse},
+    {Py_tp_clear, (void *)SbkEnumType_clear},
+    {Py_tp_getattro, (void *)SbkEnumType_getattro},
+    {Py_tp_getset, (void *)SbkEnumType_getsetlist},
     {Py_nb_add, (void *)enum_add},
     {Py_nb_subtract, (void *)enum_subtract},
     {Py_nb_multiply, (void *)enum_multiply},
@@ -315,7 +440,7 @@ static PyType_Spec SbkEnumType_Type_spec = {
     "1:Shiboken.EnumType",
     0,    // filled in later
     sizeof(PyMemberDef),
-    Py_TPFLAGS_DEFAULT|Py_TPFLAGS_BASETYPE|Py_TPFLAGS_CHECKTYPES,
+    Py_TPFLAGS_DEFAULT|Py_TPFLAGS_BASETYPE|Py_TPFLAGS_CHECKTYPES|Py_TPFLAGS_HAVE_GC,
     SbkEnumType_Type_slots,
 };
 
@@ -342,6 +467,17 @@ void SbkEnumTypeDealloc(PyObject *pyObj)
     if (PepType_SETP(sbkType)->converter) {
         Shiboken::Conversions::deleteConverter(PepType_SETP(sbkType)->converter);
     }
+    if (SbkEnumItemTable *table = PepType_SETP(sbkType)->itemTable) {
+        PepType_SETP(sbkType)->itemTable = nullptr;
+        auto *enumType = reinterpret_cast<PyTypeObject *>(pyObj);
+        for (auto &scope : pendingScopes) {
+            auto &enums = scope.second;
+            enums.erase(std::remove(enums.begin(), enums.end(), enumType), enums.end());
+        }
+        for (PyObject *object : table->objects)
+            Py_XDECREF(object);
+        delete table;
+    }
 #ifndef Py_LIMITED_API
     Py_TRASHCAN_SAFE_END(pyObj);
 #endif
@@ -352,6 +488,61 @@ void SbkEnumTypeDealloc(PyObject *pyObj)
     }
 }
 
+// The item objects cached in the table refer to the enum type.
+static int SbkEnumType_traverse(PyObject *type, visitproc visit, void *arg)
+{
+    if (SbkEnumItemTable *table = itemTable(reinterpret_cast<PyTypeObject *>(type))) {
+        for (PyObject *object : table->objects)
+            Py_VISIT(object);
+    }
+    return PyType_Type.tp_traverse(type, visit, arg);
+}
+
+static int SbkEnumType_clear(PyObject *type)
+{
+    if (SbkEnumItemTable *table = itemTable(reinterpret_cast<PyTypeObject *>(type))) {
+        for (PyObject *&object : table->objects)
+            Py_CLEAR(object);
+        table->complete = false;
+    }
+    return PyType_Type.tp_clear(type);
+}
+
+static PyObject *SbkEnumType_getattro(PyObject *type, PyObject *name)
+{
+    PyObject *result = PyType_Type.tp_getattro(type, name);
+    auto *enumType = reinterpret_cast<PyTypeObject *>(type);
+    SbkEnumItemTable *table = itemTable(enumType);
+    if (result != nullptr || table == nullptr || !PyErr_ExceptionMatches(PyExc_AttributeError))
+        return result;
+    // Items set by setEnumItems() are created on first access.
+    if (PyObject_RichCompareBool(name, Shiboken::PyName::values(), Py_EQ) == 1) {
+        if (!createAllItems(enumType, table))
+            return nullptr;
+        PyErr_Clear();
+        return PyType_Type.tp_getattro(type, name);
+    }
+    const char *itemName = Shiboken::String::toCString(name);
+    const int index = itemName != nullptr ? findItemByName(table, itemName) : -1;
+    if (index < 0)
+        return nullptr;
+    PyObject *item = itemObject(enumType, table, index);
+    if (item == nullptr)
+        return nullptr;
+    PyErr_Clear();
+    Py_INCREF(item);
+    return item;
+}
+
+static PyObject *SbkEnumType_get___dict__(PyObject *type, void *)
+{
+    auto *enumType = reinterpret_cast<PyTypeObject *>(type);
+    SbkEnumItemTable *table = itemTable(enumType);
+    if (table != nullptr && !createAllItems(enumType, table))
+        return nullptr;
+    return PyDictProxy_New(enumType->tp_dict);
+}
+
 PyObject *SbkEnumTypeTpNew(PyTypeObject *metatype, PyObject *args, PyObject *kwds)
 {
     auto type_new = reinterpret_cast<newfunc>(PyType_GetSlot(&PyType_Type, Py_tp_new));
@@ -492,6 +683,13 @@ bool check(PyObject *pyObj)
 
 PyObject *getEnumItemFromValue(PyTypeObject *enumType, long itemValue)
 {
+    if (SbkEnumItemTable *table = itemTable(enumType)) {
+        const int index = findItemByValue(table, itemValue);
+        PyObject *result = index >= 0 ? itemObject(enumType, table, index) : nullptr;
+        Py_XINCREF(result);
+        return result;
+    }
+
     PyObject *key, *value;
     Py_ssize_t pos = 0;
     PyObject *values = PyDict_GetItem(enumType->tp_dict, Shiboken::PyName::values());
@@ -585,6 +783,100 @@ bool createScopedEnumItem(PyTypeObject *enumType, SbkObjectType *scope, const ch
     return createScopedEnumItem(enumType, reinterpret_cast<PyTypeObject *>(scope), itemName, itemValue);
 }
 
+bool setEnumItems(PyTypeObject *enumType, PyObject *scope, const EnumItem *items, int count)
+{
+    auto *table = new SbkEnumItemTable{items, count, std::vector<PyObject *>(count, nullptr),
+                                       {}, {}, false};
+    const auto byValue = [items](int a, int b) { return items[a].value < items[b].value; };
+    for (int i = 1; i < count; ++i) {
+        if (items[i].value < items[i - 1].value) {
+            // The generator sorts by the value it sees, which might differ
+            // from the value of type long, so we keep a sorted index.
+            table->byValue.resize(count);
+            for (int j = 0; j < count; ++j)
+                table->byValue[j] = j;
+            std::stable_sort(table->byValue.begin(), table->byValue.end(), byValue);
+            break;
+        }
+    }
+    PepType_SETP(reinterpret_cast<SbkEnumType *>(enumType))->itemTable = table;
+
+    if (scope == nullptr || scope == reinterpret_cast<PyObject *>(enumType))
+        return true;
+    if (PyModule_Check(scope)) {
+        // Module attributes are created right away since they are also
+        // listed by dir() and found by "from module import *".
+        for (int i : declarationOrder(table)) {
+            PyObject *item = itemObject(enumType, table, i);
+            if (item == nullptr)
+                return false;
+            Py_INCREF(item);
+            if (PyModule_AddObject(scope, items[i].name, item) < 0) {
+                Py_DECREF(item);
+                return false;
+            }
+        }
+        return true;
+    }
+    pendingScopes[reinterpret_cast<PyTypeObject *>(scope)].push_back(enumType);
+    return true;
+}
+
+PyObject *getPendingItem(PyTypeObject *type, PyObject *name)
+{
+    if (pendingScopes.empty() || !PyErr_ExceptionMatches(PyExc_AttributeError))
+        return nullptr;
+    const char *itemName = String::toCString(name);
+    if (itemName == nullptr)
+        return nullptr;
+    PyObject *mro = type->tp_mro;
+    const Py_ssize_t size = mro != nullptr ? PyTuple_GET_SIZE(mro) : 0;
+    for (Py_ssize_t m = 0; m < size; ++m) {
+        auto *scope = reinterpret_cast<PyTypeObject *>(PyTuple_GET_ITEM(mro, m));
+        auto it = pendingScopes.find(scope);
+        if (it == pendingScopes.end())
+            continue;
+        for (PyTypeObject *enumType : it->second) {
+            SbkEnumItemTable *table = itemTable(enumType);
+            const int index = findItemByName(table, itemName);
+            if (index < 0)
+                continue;
+            PyObject *item = itemObject(enumType, table, index);
+            if (item == nullptr || PyDict_SetItem(scope->tp_dict, name, item) < 0)
+                return nullptr;
+            PyType_Modified(scope);
+            PyErr_Clear();
+            Py_INCREF(item);
+            return item;
+        }
+    }
+    return nullptr;
+}
+
+bool createPendingItems(PyTypeObject *type)
+{
+    auto it = pendingScopes.find(type);
+    if (it == pendingScopes.end())
+        return true;
+    for (PyTypeObject *enumType : it->second) {
+        SbkEnumItemTable *table = itemTable(enumType);
+        if (!createAllItems(enumType, table))
+            return false;
+        for (int i : declarationOrder(table)) {
+            if (PyDict_SetItemString(type->tp_dict, table->items[i].name, table->objects[i]) < 0)
+                return false;
+        }
+    }
+    PyType_Modified(type);
+    // Keep the entry: The feature selection might exchange the type dict.
+    return true;
+}
+
+void removePendingScope(PyTypeObject *type)
+{
+    pendingScopes.erase(type);
+}
+
 PyObject *
 newItem(PyTypeObject *enumType, long itemValue, const char *itemName)
 {
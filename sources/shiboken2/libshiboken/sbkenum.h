@@ -103,6 +103,44 @@ namespace Enum
 
     LIBSHIBOKEN_API PyObject *newItem(PyTypeObject *enumType, long itemValue, const char *itemName = nullptr);
 
+    /// An item of the table of enum items passed to setEnumItems().
+    struct EnumItem
+    {
+        const char *name;
+        long value;
+        int index;      // position in the declaration of the enum
+    };
+
+    /**
+     *  Sets the items of an enum type from a static table instead of creating
+     *  them one by one with createGlobalEnumItem() or createScopedEnumItem().
+     *  The Python objects of the items are created on first access and cached.
+     *  \param enumType  Enum type the items belong to.
+     *  \param scope     Module or Shiboken type enclosing the enum, which also
+     *                   gets the items, or nullptr for C++11 enum classes.
+     *                   Items are added to a module immediately.
+     *  \param items     Table of \p count items sorted by value. The
+     *                   index member gives the declaration order.
+     *  \return true if everything goes fine, false if it fails.
+     */
+    LIBSHIBOKEN_API bool setEnumItems(PyTypeObject *enumType, PyObject *scope,
+                                      const EnumItem *items, int count);
+
+    /**
+     *  Looks up an enum item named \p name whose object was not yet created
+     *  in the enums enclosed by \p type or its bases. This is called when
+     *  looking up the attribute in \p type or its instances failed.
+     *  \return a new reference to the item, clearing the AttributeError,
+     *          or nullptr leaving the error set.
+     */
+    LIBSHIBOKEN_API PyObject *getPendingItem(PyTypeObject *type, PyObject *name);
+
+    /// Creates the enum items not yet accessed of the enums enclosed by \p type.
+    LIBSHIBOKEN_API bool createPendingItems(PyTypeObject *type);
+
+    /// Forgets the enums enclosed by \p type when it is destroyed.
+    LIBSHIBOKEN_API void removePendingScope(PyTypeObject *type);
+
     LIBSHIBOKEN_API PyTypeObject *newTypeWithName(const char *name, const char *cppName,
                                                   PyTypeObject *numbers_fromFlag=nullptr);
     LIBSHIBOKEN_API const char *getCppName(PyTypeObject *type);
@@ -0,0 +1,197 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of Qt for Python.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "sbkimportprofile.h"
+#include "autodecref.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace Shiboken
+{
+namespace ImportProfile
+{
+
+struct Event
+{
+    std::string category;
+    std::string module;
+    std::string name;
+    long long start;
+    long long end;
+};
+
+using Events = std::vector<Event>;
+
+static Events events;
+static int enabledState = -1;   // -1: environment not yet evaluated
+static std::string traceFileName;
+
+static void writeTraceAtExit()
+{
+    if (!writeChromeTrace(traceFileName.c_str()))
+        std::fprintf(stderr, "Unable to write the import profile to \"%s\".\n", traceFileName.c_str());
+}
+
+static void initFromEnvironment()
+{
+    enabledState = 0;
+    const char *value = std::getenv("SHIBOKEN_IMPORT_PROFILE");
+    if (value == nullptr || value[0] == '\0' || std::strcmp(value, "0") == 0)
+        return;
+    enabledState = 1;
+    const size_t size = std::strlen(value);
+    if (size > 5 && std::strcmp(value + size - 5, ".json") == 0) {
+        traceFileName = value;
+        Py_AtExit(writeTraceAtExit);
+    }
+}
+
+bool isEnabled()
+{
+    if (enabledState < 0)
+        initFromEnvironment();
+    return enabledState == 1;
+}
+
+void setEnabled(bool enabled)
+{
+    if (enabledState < 0)
+        initFromEnvironment();
+    enabledState = enabled ? 1 : 0;
+}
+
+long long now()
+{
+    const auto duration = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+}
+
+void record(const char *category, const char *module, const char *name,
+            long long startNs, long long endNs)
+{
+    events.push_back({category, module, name, startNs, endNs});
+}
+
+void clear()
+{
+    events.clear();
+}
+
+PyObject *report()
+{
+    // Sort by module, name and category for a stable report.
+    using Categories = std::map<std::string, double>;
+    using Names = std::map<std::string, Categories>;
+    std::map<std::string, Names> modules;
+    for (const Event &e : events)
+        modules[e.module][e.name][e.category] += double(e.end - e.start) / 1e9;
+
+    AutoDecRef result(PyDict_New());
+    if (result.isNull())
+        return nullptr;
+    for (const auto &module : modules) {
+        AutoDecRef names(PyDict_New());
+        if (names.isNull() || PyDict_SetItemString(result, module.first.c_str(), names) < 0)
+            return nullptr;
+        for (const auto &name : module.second) {
+            AutoDecRef categories(PyDict_New());
+            if (categories.isNull() || PyDict_SetItemString(names, name.first.c_str(), categories) < 0)
+                return nullptr;
+            for (const auto &category : name.second) {
+                AutoDecRef seconds(PyFloat_FromDouble(category.second));
+                if (seconds.isNull()
+                    || PyDict_SetItemString(categories, category.first.c_str(), seconds) < 0) {
+                    return nullptr;
+                }
+            }
+        }
+    }
+    PyObject *ret = result.object();
+    Py_INCREF(ret);
+    return ret;
+}
+
+static void writeJsonString(FILE *file, const std::string &value)
+{
+    std::fputc('"', file);
+    for (const char c : value) {
+        if (c == '"' || c == '\\')
+            std::fprintf(file, "\\%c", c);
+        else if (static_cast<unsigned char>(c) < 0x20)
+            std::fprintf(file, "\\u%04x", unsigned(c));
+        else
+            std::fputc(c, file);
+    }
+    std::fputc('"', file);
+}
+
+bool writeChromeTrace(const char *fileName)
+{
+    FILE *file = std::fopen(fileName, "w");
+    if (file == nullptr)
+        return false;
+    // Complete events ("ph": "X") with time stamps in microseconds relative
+    // to the first event.
+    const long long origin = events.empty() ? 0 : events.front().start;
+    std::fputs("{\"traceEvents\": [", file);
+    for (size_t i = 0, size = events.size(); i < size; ++i) {
+        const Event &e = events.at(i);
+        std::fputs(i ? ",\n" : "\n", file);
+        std::fputs("{\"name\": ", file);
+        writeJsonString(file, e.name);
+        std::fputs(", \"cat\": ", file);
+        writeJsonString(file, e.category);
+        std::fprintf(file, ", \"ph\": \"X\", \"ts\": %.3f, \"dur\": %.3f, \"pid\": 1, \"tid\": 1",
+                     double(e.start - origin) / 1e3, double(e.end - e.start) / 1e3);
+        std::fputs(", \"args\": {\"module\": ", file);
+        writeJsonString(file, e.module);
+        std::fputs("}}", file);
+    }
+    std::fputs("\n], \"displayTimeUnit\": \"ms\"}\n", file);
+    return std::fclose(file) == 0;
+}
+
+} // namespace ImportProfile
+} // namespace Shiboken
@@ -0,0 +1,118 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of Qt for Python.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef SBK_IMPORTPROFILE_H
+#define SBK_IMPORTPROFILE_H
+
+#include "sbkpython.h"
+#include "shibokenmacros.h"
+
+namespace Shiboken {
+namespace ImportProfile {
+
+/**
+ *  Returns whether the import time profiling is enabled. It is initially
+ *  enabled by setting the environment variable SHIBOKEN_IMPORT_PROFILE to
+ *  a non-empty value other than "0". If the value ends with ".json", a trace
+ *  in the Chrome trace event format is written to that file at exit.
+ */
+LIBSHIBOKEN_API bool isEnabled();
+
+/// Enables or disables the import time profiling.
+LIBSHIBOKEN_API void setEnabled(bool enabled);
+
+/// Returns a monotonic time stamp in nanoseconds.
+LIBSHIBOKEN_API long long now();
+
+/**
+ *  Records an event of \p category (for example "class" or "enum") which
+ *  happened during the initialization of \p name in module \p module.
+ *  \param startNs  Time stamp returned by now() when the event started.
+ *  \param endNs    Time stamp returned by now() when the event ended.
+ */
+LIBSHIBOKEN_API void record(const char *category, const char *module, const char *name,
+                            long long startNs, long long endNs);
+
+/// Discards the recorded events.
+LIBSHIBOKEN_API void clear();
+
+/**
+ *  Returns the recorded events as a dict mapping the module names to dicts
+ *  mapping the names to dicts of categories and the accumulated time in seconds.
+ *  Nested events are included in the time of the enclosing event.
+ *  \returns a new reference or nullptr if an error occurs.
+ */
+LIBSHIBOKEN_API PyObject *report();
+
+/**
+ *  Writes the recorded events in the Chrome trace event format to
+ *  \p fileName, which can be loaded by chrome://tracing or Perfetto.
+ *  \returns whether the file could be written.
+ */
+LIBSHIBOKEN_API bool writeChromeTrace(const char *fileName);
+
+/// Records the life time of the object as event when profiling is enabled.
+class ScopedEvent
+{
+public:
+    ScopedEvent(const ScopedEvent &) = delete;
+    ScopedEvent &operator=(const ScopedEvent &) = delete;
+
+    explicit ScopedEvent(const char *category, const char *module, const char *name)
+        : m_category(category), m_module(module), m_name(name),
+          m_start(isEnabled() ? now() : -1)
+    {
+    }
+
+    ~ScopedEvent()
+    {
+        if (m_start >= 0)
+            record(m_category, m_module, m_name, m_start, now());
+    }
+
+private:
+    const char *m_category;
+    const char *m_module;
+    const char *m_name;
+    long long m_start;
+};
+
+} } // namespace Shiboken::ImportProfile
+
+#endif // SBK_IMPORTPROFILE_H
@@ -0,0 +1,168 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of Qt for Python.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "sbkmemoryreport.h"
+#include "autodecref.h"
+#include "basewrapper.h"
+#include "basewrapper_p.h"
+#include "bindingmanager.h"
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Shiboken
+{
+namespace MemoryReport
+{
+
+// The node size of std::set is implementation specific,
+// this is the usual size of the red-black tree nodes.
+static const std::size_t setNodeOverhead = 4 * sizeof(void *);
+
+static std::size_t parentInfoSize(const ParentInfo *info)
+{
+    return sizeof(ParentInfo)
+        + info->children.size() * (setNodeOverhead + sizeof(SbkObject *));
+}
+
+// Returns the number of objects of the tree starting at `root`.
+static std::size_t treeSize(SbkObject *root)
+{
+    std::size_t result = 0;
+    std::vector<SbkObject *> pending(1, root);
+    while (!pending.empty()) {
+        SbkObject *object = pending.back();
+        pending.pop_back();
+        ++result;
+        if (const ParentInfo *info = object->d->parentInfo)
+            pending.insert(pending.end(), info->children.cbegin(), info->children.cend());
+    }
+    return result;
+}
+
+static bool setItem(PyObject *dict, const char *key, std::size_t value)
+{
+    AutoDecRef number(PyLong_FromSize_t(value));
+    return !number.isNull() && PyDict_SetItemString(dict, key, number) == 0;
+}
+
+PyObject *report(int maxTrees)
+{
+    const std::set<PyObject *> wrappers = BindingManager::instance().getAllPyObjects();
+
+    std::map<std::string, std::size_t> types;
+    std::map<std::string, std::size_t> references;
+    std::vector<std::pair<std::size_t, SbkObject *> > trees;
+    std::size_t privateBytes = 0;
+    std::size_t parentInfoBytes = 0;
+    std::size_t refCountListBytes = 0;
+
+    for (PyObject *pyObj : wrappers) {
+        if (pyObj == nullptr)
+            continue;
+        auto *wrapper = reinterpret_cast<SbkObject *>(pyObj);
+        ++types[Py_TYPE(pyObj)->tp_name];
+        if (!wrapper->d->isInline)
+            privateBytes += sizeof(SbkObjectPrivate);
+        if (const ParentInfo *info = wrapper->d->parentInfo) {
+            parentInfoBytes += parentInfoSize(info);
+            if (info->parent == nullptr && !info->children.empty())
+                trees.push_back({treeSize(wrapper), wrapper});
+        }
+        // The inline entries are part of SbkObjectPrivate, only count the overflow.
+        const RefCountList &list = wrapper->d->referredObjects;
+        refCountListBytes += list.heapSize();
+        for (const auto &entry : list)
+            ++references[Object::referenceKey(entry.first)];
+    }
+
+    const auto treeCount = std::min(trees.size(), std::size_t(std::max(maxTrees, 0)));
+    std::partial_sort(trees.begin(), trees.begin() + treeCount, trees.end(),
+                      [](const std::pair<std::size_t, SbkObject *> &lhs,
+                         const std::pair<std::size_t, SbkObject *> &rhs) {
+                          return lhs.first > rhs.first;
+                      });
+
+    AutoDecRef result(PyDict_New());
+    AutoDecRef typeDict(PyDict_New());
+    AutoDecRef bytes(PyDict_New());
+    AutoDecRef treeList(PyList_New(0));
+    AutoDecRef referenceDict(PyDict_New());
+    if (result.isNull() || typeDict.isNull() || bytes.isNull() || treeList.isNull()
+        || referenceDict.isNull()) {
+        return nullptr;
+    }
+    for (const auto &type : types) {
+        if (!setItem(typeDict, type.first.c_str(), type.second))
+            return nullptr;
+    }
+    if (!setItem(bytes, "SbkObjectPrivate", privateBytes)
+        || !setItem(bytes, "ParentInfo", parentInfoBytes)
+        || !setItem(bytes, "RefCountList", refCountListBytes)
+        || !setItem(bytes, "total", privateBytes + parentInfoBytes + refCountListBytes)) {
+        return nullptr;
+    }
+    for (std::size_t i = 0; i < treeCount; ++i) {
+        AutoDecRef tree(Py_BuildValue("(On)", reinterpret_cast<PyObject *>(trees[i].second),
+                                      Py_ssize_t(trees[i].first)));
+        if (tree.isNull() || PyList_Append(treeList, tree) < 0)
+            return nullptr;
+    }
+    for (const auto &reference : references) {
+        if (!setItem(referenceDict, reference.first.c_str(), reference.second))
+            return nullptr;
+    }
+    if (!setItem(result, "wrappers", wrappers.size() - wrappers.count(nullptr))
+        || PyDict_SetItemString(result, "types", typeDict) < 0
+        || PyDict_SetItemString(result, "bytes", bytes) < 0
+        || PyDict_SetItemString(result, "trees", treeList) < 0
+        || PyDict_SetItemString(result, "references", referenceDict) < 0) {
+        return nullptr;
+    }
+    PyObject *ret = result.object();
+    Py_INCREF(ret);
+    return ret;
+}
+
+} // namespace MemoryReport
+} // namespace Shiboken
@@ -0,0 +1,72 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of Qt for Python.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef SBK_MEMORYREPORT_H
+#define SBK_MEMORYREPORT_H
+
+#include "sbkpython.h"
+#include "shibokenmacros.h"
+
+namespace Shiboken {
+namespace MemoryReport {
+
+/**
+ *  Returns a snapshot of the memory held by the binding layer for the live
+ *  wrappers as a dict with the keys:
+ *
+ *  - "wrappers": the number of live wrappers.
+ *  - "types": a dict mapping the type names to the number of live wrappers.
+ *  - "bytes": a dict with the approximate number of bytes held by the private
+ *    structures of the wrappers ("SbkObjectPrivate", "ParentInfo" and
+ *    "RefCountList", which only counts the references that did not fit
+ *    into SbkObjectPrivate) and their sum ("total").
+ *  - "trees": a list of (root, size) tuples of the \p maxTrees largest
+ *    parent-child trees, where size is the number of objects in the tree.
+ *  - "references": a dict mapping the keys of the references kept by
+ *    Object::keepReference() to their number.
+ *
+ *  The snapshot is taken by one pass over the wrappers; nothing is recorded
+ *  while no snapshot is requested.
+ *  \returns a new reference or nullptr if an error occurs.
+ */
+LIBSHIBOKEN_API PyObject *report(int maxTrees = 10);
+
+} } // namespace Shiboken::MemoryReport
+
+#endif // SBK_MEMORYREPORT_H
@@ -40,7 +40,14 @@
 #include "sbkmodule.h"
 #include "basewrapper.h"
 #include "bindingmanager.h"
+#include "autodecref.h"
+#include "sbkdbg.h"
+#include "sbkstring.h"
+#include <cstdio>
+#include <cstring>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 /// This hash maps module objects to arrays of Python types.
 using ModuleTypesMap = std::unordered_map<PyObject *, PyTypeObject **> ;
@@ -52,6 +59,28 @@ using ModuleConvertersMap = std::unordered_map<PyObject *, SbkConverter **>;
 static ModuleTypesMap moduleTypes;
 static ModuleConvertersMap moduleConverters;
 
+/// Types of a module registered for creation on demand.
+struct LazyTypeModule
+{
+    enum State : char { Pending, Creating, Done };
+
+    PyObject *module;
+    PyTypeObject **types;
+    const Shiboken::Module::LazyType *lazyTypes;
+    int count;
+    std::vector<State> states;
+    std::vector<std::vector<int> > nestedTypes; // Created along with the enclosing type
+    std::unordered_map<std::string, int> moduleLevelTypes;
+};
+
+/// This hash maps arrays of types to their lazy creation data.
+using LazyTypeModuleMap = std::unordered_map<PyTypeObject **, LazyTypeModule>;
+/// This hash maps C++ and typeid() names to an array of types and an index.
+using LazyTypeNameMap = std::unordered_map<std::string, std::pair<PyTypeObject **, int> >;
+
+static LazyTypeModuleMap lazyTypeModules;
+static LazyTypeNameMap lazyTypeNames;
+
 namespace Shiboken
 {
 namespace Module
@@ -108,4 +137,192 @@ SbkConverter **getTypeConverters(PyObject *module)
     return (iter == moduleConverters.end()) ? 0 : iter->second;
 }
 
+static LazyTypeModule *findLazyTypeModule(PyObject *module)
+{
+    for (auto &it : lazyTypeModules) {
+        if (it.second.module == module)
+            return &it.second;
+    }
+    return nullptr;
+}
+
+// Module __getattr__ (PEP 562) creating the types on first access
+static PyObject *lazyModuleGetattr(PyObject *module, PyObject *name)
+{
+    const char *typeName = String::toCString(name);
+    if (LazyTypeModule *lazyModule = findLazyTypeModule(module)) {
+        auto it = lazyModule->moduleLevelTypes.find(typeName);
+        if (it != lazyModule->moduleLevelTypes.end()
+            && getType(lazyModule->types, it->second) != nullptr) {
+            if (PyObject *result = PyDict_GetItem(PyModule_GetDict(module), name)) {
+                Py_INCREF(result);
+                return result;
+            }
+        }
+    }
+    if (!PyErr_Occurred()) {
+        PyErr_Format(PyExc_AttributeError, "module '%s' has no attribute '%s'",
+                     PyModule_GetName(module), typeName);
+    }
+    return nullptr;
+}
+
+// Module __dir__ listing the types not yet created
+static PyObject *lazyModuleDir(PyObject *module, PyObject *)
+{
+    PyObject *result = PyDict_Keys(PyModule_GetDict(module));
+    if (result == nullptr)
+        return nullptr;
+    if (LazyTypeModule *lazyModule = findLazyTypeModule(module)) {
+        for (const auto &it : lazyModule->moduleLevelTypes) {
+            if (lazyModule->types[it.second] == nullptr) {
+                AutoDecRef name(String::fromCString(it.first.c_str()));
+                PyList_Append(result, name);
+            }
+        }
+    }
+    PyList_Sort(result);
+    return result;
+}
+
+static PyMethodDef lazyModuleMethods[] = {
+    {"__getattr__", reinterpret_cast<PyCFunction>(lazyModuleGetattr), METH_O, nullptr},
+    {"__dir__", reinterpret_cast<PyCFunction>(lazyModuleDir), METH_NOARGS, nullptr},
+    {nullptr, nullptr, 0, nullptr}
+};
+
+// Module __getattr__ requires Python 3.7; check the runtime version
+// since the limited API may be used.
+static bool supportsModuleGetattr()
+{
+    int major = 0;
+    int minor = 0;
+    return std::sscanf(Py_GetVersion(), "%d.%d", &major, &minor) == 2
+        && (major > 3 || (major == 3 && minor >= 7));
+}
+
+void registerLazyTypes(PyObject *module, PyTypeObject **types,
+                       const LazyType *lazyTypes, int count)
+{
+    LazyTypeModule &lazyModule = lazyTypeModules[types];
+    lazyModule.module = module;
+    lazyModule.types = types;
+    lazyModule.lazyTypes = lazyTypes;
+    lazyModule.count = count;
+    lazyModule.states.assign(count, LazyTypeModule::Pending);
+    lazyModule.nestedTypes.assign(count, std::vector<int>());
+    for (int i = 0; i < count; ++i) {
+        const LazyType &lazyType = lazyTypes[i];
+        if (lazyType.cppName == nullptr)
+            continue;
+        lazyTypeNames.insert(std::make_pair(std::string(lazyType.cppName), std::make_pair(types, i)));
+        if (lazyType.typeIdName != nullptr)
+            lazyTypeNames.insert(std::make_pair(std::string(lazyType.typeIdName), std::make_pair(types, i)));
+        if (lazyType.name != nullptr)
+            lazyModule.moduleLevelTypes.insert(std::make_pair(std::string(lazyType.name), i));
+        if (lazyType.init != nullptr && lazyType.enclosingIndex >= 0)
+            lazyModule.nestedTypes[lazyType.enclosingIndex].push_back(i);
+    }
+
+    if (!supportsModuleGetattr())
+        return;
+    for (PyMethodDef *def = lazyModuleMethods; def->ml_name != nullptr; ++def) {
+        AutoDecRef func(PyCFunction_NewEx(def, module, nullptr));
+        PyModule_AddObject(module, def->ml_name, func.object());
+        Py_INCREF(func.object()); // PyModule_AddObject() steals the reference
+    }
+}
+
+void finishLazyTypes(PyObject *module)
+{
+    LazyTypeModule *lazyModule = findLazyTypeModule(module);
+    if (lazyModule == nullptr)
+        return;
+    if (!supportsModuleGetattr()) {
+        for (int i = 0; i < lazyModule->count; ++i)
+            getType(lazyModule->types, i);
+    }
+
+    // Star imports only see the types listed in __all__. It consists of the
+    // registered module level types and the public attributes added by the
+    // module initialization so far, excluding imported modules.
+    PyObject *all = PyList_New(0);
+    for (const auto &it : lazyModule->moduleLevelTypes) {
+        AutoDecRef name(String::fromCString(it.first.c_str()));
+        PyList_Append(all, name);
+    }
+    PyObject *key{};
+    PyObject *value{};
+    Py_ssize_t pos = 0;
+    PyObject *dict = PyModule_GetDict(module);
+    while (PyDict_Next(dict, &pos, &key, &value)) {
+        const char *name = String::toCString(key);
+        if (name[0] != '_' && !PyModule_Check(value)
+            && lazyModule->moduleLevelTypes.find(name) == lazyModule->moduleLevelTypes.end()) {
+            PyList_Append(all, key);
+        }
+    }
+    PyList_Sort(all);
+    PyModule_AddObject(module, "__all__", all);
+}
+
+PyTypeObject *createLazyType(PyTypeObject **types, int index)
+{
+    auto it = lazyTypeModules.find(types);
+    if (it == lazyTypeModules.end() || index < 0 || index >= it->second.count)
+        return types[index];
+    LazyTypeModule &lazyModule = it->second;
+    const LazyType &lazyType = lazyModule.lazyTypes[index];
+    if (lazyType.cppName == nullptr || lazyModule.states[index] != LazyTypeModule::Pending)
+        return types[index];
+    lazyModule.states[index] = LazyTypeModule::Creating;
+
+    PyObject *enclosingObject = lazyModule.module;
+    if (lazyType.enclosingIndex >= 0) {
+        PyTypeObject *enclosingType = getType(types, lazyType.enclosingIndex);
+        // Enumerations and nested types are created by their enclosing type.
+        if (enclosingType == nullptr || lazyType.init == nullptr || types[index] != nullptr) {
+            lazyModule.states[index] = LazyTypeModule::Done;
+            return types[index];
+        }
+        enclosingObject = enclosingType->tp_dict;
+    }
+    if (lazyType.init != nullptr) {
+        if (Py_VerboseFlag > 0)
+            SbkDbg() << "Creating type '" << lazyType.cppName << "' on demand.";
+        lazyType.init(enclosingObject);
+    }
+    lazyModule.states[index] = LazyTypeModule::Done;
+    if (types[index] != nullptr) {
+        for (int nestedIndex : lazyModule.nestedTypes.at(index))
+            getType(types, nestedIndex);
+    }
+    return types[index];
+}
+
+// Strip qualifiers from a type name passed to getConverter(): "const Foo &" -> "Foo"
+static std::string plainTypeName(const char *typeName)
+{
+    std::string result(typeName);
+    if (result.compare(0, 6, "const ") == 0)
+        result.erase(0, 6);
+    while (!result.empty() && std::strchr("*& ", result.back()) != nullptr)
+        result.pop_back();
+    return result;
+}
+
+bool createLazyTypeByName(const char *typeName)
+{
+    if (lazyTypeNames.empty())
+        return false;
+    auto it = lazyTypeNames.find(typeName);
+    if (it == lazyTypeNames.end())
+        it = lazyTypeNames.find(plainTypeName(typeName));
+    if (it == lazyTypeNames.end())
+        return false;
+    PyTypeObject **types = it->second.first;
+    const int index = it->second.second;
+    return types[index] == nullptr && createLazyType(types, index) != nullptr;
+}
+
 } } // namespace Shiboken::Module
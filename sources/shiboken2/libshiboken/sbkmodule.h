@@ -110,6 +110,64 @@ LIBSHIBOKEN_API void registerTypeConverters(PyObject *module, SbkConverter **con
  */
 LIBSHIBOKEN_API SbkConverter **getTypeConverters(PyObject *module);
 
+/// Function creating a type, receiving the module or the dict of the enclosing type.
+using TypeInitFunction = void (*)(PyObject *);
+
+/**
+ *  Describes how an entry of the array of types of a module is created on
+ *  demand. Entries without C++ name are not created lazily.
+ */
+struct LazyType
+{
+    const char *name;       // Python name of a module level type or nullptr
+    const char *cppName;    // Qualified C++ name used for converter lookups
+    const char *typeIdName; // typeid() name used for polymorphic lookups or nullptr
+    TypeInitFunction init;  // nullptr for types created by the enclosing type (enums)
+    int enclosingIndex;     // Index of the enclosing type or -1
+};
+
+/**
+ *  Registers the types of \p module to be created on first access through
+ *  getType(), as module attribute (PEP 562) or by converter lookups.
+ *  \param module     Module where the types are created.
+ *  \param types      Array of types of the module as passed to registerTypes().
+ *  \param lazyTypes  Array of \p count entries describing the creation of the types.
+ */
+LIBSHIBOKEN_API void registerLazyTypes(PyObject *module, PyTypeObject **types,
+                                       const LazyType *lazyTypes, int count);
+
+/**
+ *  Completes the initialization of a module registered by registerLazyTypes()
+ *  by setting its __all__ attribute to the registered module level types and
+ *  the public attributes added so far, excluding modules. All types are
+ *  created at this point if the Python version does not support module
+ *  __getattr__.
+ */
+LIBSHIBOKEN_API void finishLazyTypes(PyObject *module);
+
+/**
+ *  Creates the type at \p index of \p types registered by registerLazyTypes().
+ *  \returns the type or nullptr if it cannot be created.
+ */
+LIBSHIBOKEN_API PyTypeObject *createLazyType(PyTypeObject **types, int index);
+
+/**
+ *  Returns the type at \p index of the array of types \p types of a module,
+ *  creating it on first access.
+ */
+inline PyTypeObject *getType(PyTypeObject **types, int index)
+{
+    PyTypeObject *type = types[index];
+    return type != nullptr ? type : createLazyType(types, index);
+}
+
+/**
+ *  Creates a pending type by its C++ or typeid() name, which is used when a
+ *  converter lookup fails.
+ *  \returns whether a type was created.
+ */
+LIBSHIBOKEN_API bool createLazyTypeByName(const char *typeName);
+
 } } // namespace Shiboken::Module
 
 #endif // SBK_MODULE_H
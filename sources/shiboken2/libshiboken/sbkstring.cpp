@@ -41,6 +41,8 @@
 #include "sbkstaticstrings_p.h"
 #include "autodecref.h"
 
+#include <cstring>
+#include <string>
 #include <vector>
 #include <unordered_set>
 
@@ -283,13 +285,23 @@ PyObject *createStaticString(const char *str)
     return result;
 }
 
+// Interns a table of strings at once. `strings` contains the strings separated
+// by '\0' and is terminated by an empty string. This is used by the generated
+// modules for the method names which are known at generation time.
+void createStaticStrings(const char *strings, PyObject *result[])
+{
+    for (const char *str = strings; *str != '\0'; str += std::strlen(str) + 1)
+        *result++ = createStaticString(str);
+}
+
 ///////////////////////////////////////////////////////////////////////
 //
 // PYSIDE-1019: Helper function for snake_case vs. camelCase names
 // ---------------------------------------------------------------
 //
 // When renaming dict entries, `BindingManager::getOverride` must
-// use adapted names.
+// use adapted names. The generated modules convert the names of virtual
+// methods at generation time, see `createStaticStrings`.
 //
 // This might become more complex when we need to register
 // exceptions from this rule.
@@ -309,22 +321,20 @@ PyObject *getSnakeCaseName(const char *name, bool lower)
         || (name[0] == 'g' && name[1] == 'l' && isupper(name[2])))
         return createStaticString(name);
 
-    char new_name[200 + 1] = {};
-    const char *p = name;
-    char *q = new_name;
-    for (; *p && q - new_name < 200; ++p, ++q) {
+    std::string new_name;
+    new_name.reserve(std::strlen(name) + 8);
+    for (const char *p = name; *p; ++p) {
         if (isupper(*p)) {
             if (p != name && isupper(*(p - 1)))
                 return createStaticString(name);
-            *q = '_';
-            ++q;
-            *q = tolower(*p);
+            new_name += '_';
+            new_name += char(tolower(*p));
         }
         else {
-            *q = *p;
+            new_name += *p;
         }
     }
-    return createStaticString(new_name);
+    return createStaticString(new_name.c_str());
 }
 
 PyObject *getSnakeCaseName(PyObject *name, bool lower)
@@ -50,6 +50,8 @@
 #include "sbkarrayconverter.h"
 #include "sbkconverter.h"
 #include "sbkenum.h"
+#include "sbkimportprofile.h"
+#include "sbkmemoryreport.h"
 #include "sbkmodule.h"
 #include "sbkstring.h"
 #include "sbkstaticstrings.h"
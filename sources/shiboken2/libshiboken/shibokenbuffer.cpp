@@ -38,6 +38,9 @@
 ****************************************************************************/
 
 #include "shibokenbuffer.h"
+#include "basewrapper.h"
+#include "helper.h"
+#include "autodecref.h"
 #include <cstdlib>
 #include <cstring>
 
@@ -74,6 +77,107 @@ void *Shiboken::Buffer::getPointer(PyObject *pyObj, Py_ssize_t *size)
     return const_cast<void *>(buffer);
 }
 
+#ifdef IS_PY3K
+// Returns the size of a native struct format character or 0 if it is not a
+// plain number.
+static Py_ssize_t formatCharSize(char c)
+{
+    switch (c) {
+    case 'b': case 'B': case '?':
+        return 1;
+    case 'h': case 'H':
+        return sizeof(short);
+    case 'i': case 'I':
+        return sizeof(int);
+    case 'l': case 'L':
+        return sizeof(long);
+    case 'q': case 'Q':
+        return sizeof(long long);
+    case 'f':
+        return sizeof(float);
+    case 'd':
+        return sizeof(double);
+    default:
+        break;
+    }
+    return 0;
+}
+
+// Returns the size of the items of a native struct format or 0 if it contains
+// other characters than plain numbers.
+static Py_ssize_t formatSize(const char *format)
+{
+    Py_ssize_t result = 0;
+    for (; *format != 0; ++format) {
+        const Py_ssize_t size = formatCharSize(*format);
+        if (size == 0)
+            return 0;
+        result += size;
+    }
+    return result;
+}
+
+// Strips the native byte order and alignment prefix.
+static const char *nativeFormat(const char *format)
+{
+    if (format == nullptr)
+        return "B";
+#if PY_LITTLE_ENDIAN
+    const char nativeByteOrder = '<';
+#else
+    const char nativeByteOrder = '>';
+#endif
+    if (*format == '@' || *format == '=' || *format == nativeByteOrder)
+        ++format;
+    return format;
+}
+#endif // IS_PY3K
+
+Py_ssize_t Shiboken::Buffer::itemCount(PyObject *pyObj, const char *format, Py_ssize_t itemSize)
+{
+#ifdef IS_PY3K
+    // The format must describe the complete item, otherwise the C++ type
+    // has a different layout on this platform (qreal being float).
+    const size_t formatLength = strlen(format);
+    if (formatSize(format) != itemSize || !PyObject_CheckBuffer(pyObj))
+        return -1;
+
+    Py_buffer view;
+    if (PyObject_GetBuffer(pyObj, &view, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT) != 0) {
+        PyErr_Clear();
+        return -1;
+    }
+    const char *viewFormat = nativeFormat(view.format);
+    bool matches = strcmp(viewFormat, format) == 0;
+    if (!matches && strlen(viewFormat) == 1 && view.itemsize == formatCharSize(viewFormat[0])) {
+        matches = true;
+        for (size_t i = 0; matches && i < formatLength; ++i)
+            matches = format[i] == viewFormat[0];
+    }
+    const Py_ssize_t result = matches && view.len % itemSize == 0 ? view.len / itemSize : -1;
+    PyBuffer_Release(&view);
+    return result;
+#else
+    return -1;
+#endif
+}
+
+bool Shiboken::Buffer::copyData(PyObject *pyObj, void *memory, Py_ssize_t size)
+{
+#ifdef IS_PY3K
+    Py_buffer view;
+    if (PyObject_GetBuffer(pyObj, &view, PyBUF_C_CONTIGUOUS) != 0)
+        return false;
+    const bool result = view.len >= size;
+    if (result && size > 0)
+        memcpy(memory, view.buf, size_t(size));
+    PyBuffer_Release(&view);
+    return result;
+#else
+    return false;
+#endif
+}
+
 PyObject *Shiboken::Buffer::newObject(void *memory, Py_ssize_t size, Type type)
 {
     if (size == 0)
@@ -97,6 +201,144 @@ PyObject *Shiboken::Buffer::newObject(void *memory, Py_ssize_t size, Type type)
 #endif
 }
 
+bool Shiboken::Buffer::isArrayFormat(const char *format, Py_ssize_t itemSize)
+{
+#ifdef IS_PY3K
+    // memoryview.cast() only takes a single format character.
+    for (const char *c = format; *c != 0; ++c) {
+        if (*c != format[0])
+            return false;
+    }
+    return formatSize(format) == itemSize;
+#else
+    SBK_UNUSED(format)
+    SBK_UNUSED(itemSize)
+    return false;
+#endif
+}
+
+PyObject *Shiboken::Buffer::newArray(const void *memory, Py_ssize_t count, const char *format)
+{
+#ifdef IS_PY3K
+    const Py_ssize_t members = Py_ssize_t(strlen(format));
+    const Py_ssize_t size = count * formatSize(format);
+    AutoDecRef data(PyByteArray_FromStringAndSize(reinterpret_cast<const char *>(memory), size));
+    if (data.isNull())
+        return nullptr;
+    AutoDecRef view(PyMemoryView_FromObject(data));
+    if (view.isNull())
+        return nullptr;
+    const char itemFormat[2] = {format[0], 0};
+    // A shape with zeros can not be cast to, empty arrays stay one-dimensional.
+    if (members == 1 || count == 0)
+        return PyObject_CallMethod(view, "cast", "s", itemFormat);
+    return PyObject_CallMethod(view, "cast", "s(nn)", itemFormat, count, members);
+#else
+    SBK_UNUSED(memory)
+    SBK_UNUSED(count)
+    SBK_UNUSED(format)
+    PyErr_SetString(PyExc_NotImplementedError, "Arrays require Python 3.");
+    return nullptr;
+#endif
+}
+
+#ifdef IS_PY3K
+extern "C"
+{
+
+// Helper object through which a memoryview is created for memory belonging
+// to another object. It only lives until the memoryview has the buffer; the
+// view refers to the owner, which thus stays alive as long as the view.
+typedef struct {
+    PyObject_HEAD
+    void *memory;
+    Py_ssize_t size;
+    bool isWritable;
+    PyObject *owner;
+} SbkBufferExporterObject;
+
+static int SbkBufferExporterObject_getbuffer(PyObject *obj, Py_buffer *view, int flags)
+{
+    auto *exporter = reinterpret_cast<SbkBufferExporterObject *>(obj);
+    if (((flags & PyBUF_WRITABLE) == PyBUF_WRITABLE) && !exporter->isWritable) {
+        PyErr_SetString(PyExc_BufferError, "Object is not writable.");
+        return -1;
+    }
+
+    view->obj = exporter->owner;
+    Py_INCREF(exporter->owner);
+    view->buf = exporter->memory;
+    view->len = exporter->size;
+    view->readonly = exporter->isWritable ? 0 : 1;
+    view->itemsize = 1;
+    view->format = nullptr;
+    if ((flags & PyBUF_FORMAT) == PyBUF_FORMAT)
+        view->format = const_cast<char *>("B");
+    view->ndim = 1;
+    view->shape = nullptr;
+    if ((flags & PyBUF_ND) == PyBUF_ND)
+        view->shape = &(view->len);
+    view->strides = nullptr;
+    if ((flags & PyBUF_STRIDES) == PyBUF_STRIDES)
+        view->strides = &(view->itemsize);
+    view->suboffsets = nullptr;
+    view->internal = nullptr;
+    return 0;
+}
+
+static PyBufferProcs SbkBufferExporterObjectBufferProc = {
+    (getbufferproc)SbkBufferExporterObject_getbuffer,   // bf_getbuffer
+    (releasebufferproc)nullptr                           // bf_releasebuffer
+};
+
+static PyType_Slot SbkBufferExporterType_slots[] = {
+    {Py_tp_dealloc, (void *)Sbk_object_dealloc},
+    {0, nullptr}
+};
+static PyType_Spec SbkBufferExporterType_spec = {
+    "2:shiboken2.shiboken2.BufferExporter",
+    sizeof(SbkBufferExporterObject),
+    0,
+    Py_TPFLAGS_DEFAULT,
+    SbkBufferExporterType_slots,
+};
+
+}
+
+static PyTypeObject *SbkBufferExporterTypeF()
+{
+    static PyTypeObject *type = nullptr;
+    if (!type) {
+        type = reinterpret_cast<PyTypeObject *>(SbkType_FromSpec(&SbkBufferExporterType_spec));
+        PepType_AS_BUFFER(type) = &SbkBufferExporterObjectBufferProc;
+    }
+    return type;
+}
+#endif // IS_PY3K
+
+PyObject *Shiboken::Buffer::newObject(void *memory, Py_ssize_t size, Type type, PyObject *owner)
+{
+#ifdef IS_PY3K
+    if (size == 0)
+        Py_RETURN_NONE;
+    auto *exporter = PyObject_New(SbkBufferExporterObject, SbkBufferExporterTypeF());
+    if (!exporter)
+        return nullptr;
+    exporter->memory = memory;
+    exporter->size = size;
+    exporter->isWritable = type != ReadOnly;
+    exporter->owner = owner;
+    PyObject *result = PyMemoryView_FromObject(reinterpret_cast<PyObject *>(exporter));
+    Py_DECREF(exporter);
+    return result;
+#else
+    // The buffer objects of Python 2 can only refer to objects providing the
+    // old buffer protocol.
+    SBK_UNUSED(owner)
+    return newObject(memory, size, type);
+#endif
+}
+
 PyObject *Shiboken::Buffer::newObject(const void *memory, Py_ssize_t size)
 {
     return newObject(const_cast<void *>(memory), size, ReadOnly);
@@ -60,6 +60,14 @@ namespace Buffer
      */
     LIBSHIBOKEN_API PyObject *newObject(void *memory, Py_ssize_t size, Type type);
 
+    /**
+     * Creates a new Python buffer pointing to a contiguous memory block at
+     * \p memory of size \p size, which belongs to \p owner. The buffer holds
+     * a reference to \p owner, which is reported as its exporter
+     * (memoryview.obj). On Python 2, no reference is held.
+     */
+    LIBSHIBOKEN_API PyObject *newObject(void *memory, Py_ssize_t size, Type type, PyObject *owner);
+
     /**
      * Creates a new <b>read only</b> Python buffer pointing to a contiguous memory block at
      * \p memory of size \p size.
@@ -79,6 +87,34 @@ namespace Buffer
      */
     LIBSHIBOKEN_API void *getPointer(PyObject *pyObj, Py_ssize_t *size = nullptr);
 
+    /**
+     * Returns the number of items if \p pyObj is a C-contiguous buffer of items
+     * of the struct \p format and size \p itemSize, or -1 otherwise. When
+     * \p format repeats a single member ("dd"), buffers of the member format
+     * are accepted as well (NumPy arrays of shape (n, 2) and type double).
+     */
+    LIBSHIBOKEN_API Py_ssize_t itemCount(PyObject *pyObj, const char *format, Py_ssize_t itemSize);
+
+    /**
+     * Copies \p size bytes of the C-contiguous buffer \p pyObj to \p memory.
+     */
+    LIBSHIBOKEN_API bool copyData(PyObject *pyObj, void *memory, Py_ssize_t size);
+
+    /**
+     * Returns whether newArray() can create buffers of items of the struct
+     * \p format consisting of equal members ("dd"), which must describe
+     * items of size \p itemSize on this platform.
+     */
+    LIBSHIBOKEN_API bool isArrayFormat(const char *format, Py_ssize_t itemSize);
+
+    /**
+     * Creates a new Python buffer holding a copy of \p count items of the
+     * struct \p format at \p memory. For a format of several members, the
+     * buffer has the shape (count, members), so that NumPy creates a 2D array
+     * from it without copying.
+     */
+    LIBSHIBOKEN_API PyObject *newArray(const void *memory, Py_ssize_t count, const char *format);
+
 } // namespace Buffer
 } // namespace Shiboken
 
@@ -43,8 +43,36 @@
 extern "C"
 {
 
+/*
+ * Signature tables are generated instead of signature strings. The signature
+ * lines are split at generation time and the type names are stored once,
+ * so that only the types and default values need to be resolved at runtime.
+ */
+typedef struct PySideSignatureArgument {
+    const char *name;
+    int type;                   // index into the type names
+    const char *defaultValue;   // nullptr if there is no default value
+} PySideSignatureArgument;
+
+typedef struct PySideSignatureFunction {
+    const char *name;           // qualified Python name
+    int multi;                  // overload index counting down to 0, -1 if not overloaded
+    int returnType;             // index into the type names, -1 if there is none
+    int argumentCount;
+    const PySideSignatureArgument *arguments;
+} PySideSignatureFunction;
+
+typedef struct PySideSignatureTable {
+    const char *const *types;
+    int typeCount;
+    const PySideSignatureFunction *functions;
+    int functionCount;
+} PySideSignatureTable;
+
 LIBSHIBOKEN_API int InitSignatureStrings(PyTypeObject *, const char *[]);
 LIBSHIBOKEN_API void FinishSignatureInitialization(PyObject *, const char *[]);
+LIBSHIBOKEN_API int InitSignatureTable(PyTypeObject *, const PySideSignatureTable *);
+LIBSHIBOKEN_API void FinishSignatureTableInitialization(PyObject *, const PySideSignatureTable *);
 LIBSHIBOKEN_API void SetError_Argument(PyObject *, const char *, PyObject *);
 LIBSHIBOKEN_API PyObject *Sbk_TypeGet___signature__(PyObject *, PyObject *);
 LIBSHIBOKEN_API PyObject *Sbk_TypeGet___doc__(PyObject *);
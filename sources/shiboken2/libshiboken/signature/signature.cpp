@@ -298,10 +298,22 @@ PyMethodDef signature_methods[] = {
 // The parsed properties can then be used to create signature objects.
 //
 
+static int PySide_StoreSignatureArgs(PyObject *obtype_mod, PyObject *args)
+{
+    AutoDecRef type_key(GetTypeKey(obtype_mod));
+    if (type_key.isNull() || args == nullptr
+        || PyDict_SetItem(pyside_globals->arg_dict, type_key, args) < 0)
+        return -1;
+    /*
+     * We record also a mapping from type key to type/module. This helps to
+     * lazily initialize the Py_LIMITED_API in name_key_to_func().
+     */
+    return PyDict_SetItem(pyside_globals->map_dict, type_key, obtype_mod) == 0 ? 0 : -1;
+}
+
 static int PySide_BuildSignatureArgs(PyObject *obtype_mod, const char *signatures[])
 {
     init_module_1();
-    AutoDecRef type_key(GetTypeKey(obtype_mod));
     /*
      * PYSIDE-996: Avoid string overflow in MSVC, which has a limit of
      * 2**15 unicode characters (64 K memory).
@@ -310,14 +322,25 @@ static int PySide_BuildSignatureArgs(PyObject *obtype_mod, const char *signature
      * string list until really used by Python. This is quite optimal.
      */
     AutoDecRef numkey(Py_BuildValue("n", signatures));
-    if (type_key.isNull() || numkey.isNull()
-        || PyDict_SetItem(pyside_globals->arg_dict, type_key, numkey) < 0)
-        return -1;
-    /*
-     * We record also a mapping from type key to type/module. This helps to
-     * lazily initialize the Py_LIMITED_API in name_key_to_func().
-     */
-    return PyDict_SetItem(pyside_globals->map_dict, type_key, obtype_mod) == 0 ? 0 : -1;
+    return PySide_StoreSignatureArgs(obtype_mod, numkey);
+}
+
+static int PySide_BuildSignatureTableArgs(PyObject *obtype_mod,
+                                          const PySideSignatureTable *table)
+{
+    init_module_1();
+    // The table is converted to Python objects when it is really used.
+    AutoDecRef capsule(PyCapsule_New(const_cast<PySideSignatureTable *>(table),
+                                     signatureTableName, nullptr));
+    return PySide_StoreSignatureArgs(obtype_mod, capsule);
+}
+
+static PyObject *_stringlist_to_args(PyObject *type_key, PyObject *numkey)
+{
+    AutoDecRef strings(_address_to_stringlist(numkey));
+    if (strings.isNull())
+        return nullptr;
+    return Py_BuildValue("(OO)", type_key, strings.object());
 }
 
 PyObject *PySide_BuildSignatureProps(PyObject *type_key)
@@ -332,13 +355,15 @@ PyObject *PySide_BuildSignatureProps(PyObject *type_key)
     if (type_key == nullptr)
         return nullptr;
     PyObject *numkey = PyDict_GetItem(pyside_globals->arg_dict, type_key);
-    AutoDecRef strings(_address_to_stringlist(numkey));
-    if (strings.isNull())
-        return nullptr;
-    AutoDecRef arg_tup(Py_BuildValue("(OO)", type_key, strings.object()));
+    // Generated tables need no parsing of signature strings.
+    const bool isTable = PyCapsule_IsValid(numkey, signatureTableName) != 0;
+    PyObject *init_func = isTable ? pyside_globals->pyside_table_init_func
+                                  : pyside_globals->pyside_type_init_func;
+    AutoDecRef arg_tup(isTable ? _signature_table_to_args(type_key, numkey)
+                               : _stringlist_to_args(type_key, numkey));
     if (arg_tup.isNull())
         return nullptr;
-    PyObject *dict = PyObject_CallObject(pyside_globals->pyside_type_init_func, arg_tup);
+    PyObject *dict = PyObject_CallObject(init_func, arg_tup);
     if (dict == nullptr) {
         if (PyErr_Occurred())
             return nullptr;
@@ -358,7 +383,7 @@ PyObject *PySide_BuildSignatureProps(PyObject *type_key)
 //
 ////////////////////////////////////////////////////////////////////////////
 
-static int PySide_FinishSignatures(PyObject *module, const char *signatures[])
+static int PySide_FinishSignatures(PyObject *module)
 {
     /*
      * Initialization of module functions and resolving of static methods.
@@ -367,10 +392,6 @@ static int PySide_FinishSignatures(PyObject *module, const char *signatures[])
     if (name == nullptr)
         return -1;
 
-    // we abuse the call for types, since they both have a __name__ attribute.
-    if (PySide_BuildSignatureArgs(module, signatures) < 0)
-        return -1;
-
     /*
      * Note: This function crashed when called from PySide_BuildSignatureArgs.
      * Probably this was an import timing problem.
@@ -390,11 +411,10 @@ static int PySide_FinishSignatures(PyObject *module, const char *signatures[])
         return -1;
     // The finish_import function will not work the first time since phase 2
     // was not yet run. But that is ok, because the first import is always for
-    // the shiboken module (or a test module).
-    if (pyside_globals->finish_import_func == nullptr) {
-        assert(strncmp(name, "PySide2.", 8) != 0);
-        return 0;
-    }
+    // the shiboken module (or a test module). When loading the signature
+    // module is deferred, the modules are finished by phase 2.
+    if (pyside_globals->finish_import_func == nullptr)
+        return PyList_Append(pyside_globals->pending_imports, module);
     AutoDecRef ret(PyObject_CallFunction(
         pyside_globals->finish_import_func, const_cast<char *>("(O)"), module));
     return ret.isNull() ? -1 : 0;
@@ -428,8 +448,32 @@ void FinishSignatureInitialization(PyObject *module, const char *signatures[])
      * Still, it is not possible to call init phase 2 from here,
      * because the import is still running. Do it from Python!
      */
+    // we abuse the call for types, since they both have a __name__ attribute.
+    if (   PySide_PatchTypes() < 0
+        || PySide_BuildSignatureArgs(module, signatures) < 0
+        || PySide_FinishSignatures(module) < 0) {
+        PyErr_Print();
+        PyErr_SetNone(PyExc_ImportError);
+    }
+}
+
+int InitSignatureTable(PyTypeObject *type, const PySideSignatureTable *table)
+{
+    auto *ob_type = reinterpret_cast<PyObject *>(type);
+    int ret = PySide_BuildSignatureTableArgs(ob_type, table);
+    if (ret < 0) {
+        PyErr_Print();
+        PyErr_SetNone(PyExc_ImportError);
+    }
+    return ret;
+}
+
+void FinishSignatureTableInitialization(PyObject *module, const PySideSignatureTable *table)
+{
+    // See FinishSignatureInitialization().
     if (   PySide_PatchTypes() < 0
-        || PySide_FinishSignatures(module, signatures) < 0) {
+        || PySide_BuildSignatureTableArgs(module, table) < 0
+        || PySide_FinishSignatures(module) < 0) {
         PyErr_Print();
         PyErr_SetNone(PyExc_ImportError);
     }
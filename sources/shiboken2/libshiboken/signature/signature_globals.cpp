@@ -55,7 +55,7 @@ using namespace Shiboken;
 
 extern "C" {
 
-static const char *PySide_CompressedSignaturePackage[] = {
+static const unsigned char PySide_SignatureArchive[] = {
 #include "embed/signature_inc.h"
     };
 
@@ -63,10 +63,21 @@ static const unsigned char PySide_SignatureLoader[] = {
 #include "embed/signature_bootstrap_inc.h"
     };
 
+static bool lazy_signature_import()
+{
+    /*
+     * With "sys.pyside_lazy_signature" set to a true value, the signature
+     * package is not loaded during the import but on first use.
+     */
+    PyObject *lazy = PySys_GetObject(const_cast<char *>("pyside_lazy_signature"));
+    return lazy != nullptr && PyObject_IsTrue(lazy) == 1;
+}
+
 static PyObject *_init_pyside_extension(PyObject * /* self */, PyObject * /* args */)
 {
     init_module_1();
-    init_module_2();
+    if (!lazy_signature_import())
+        init_module_2();
     Py_RETURN_NONE;
 }
 
@@ -125,25 +136,17 @@ static safe_globals_struc *init_phase_1(PyMethodDef *init_meth)
         if (PyDict_SetItem(mdict, PyMagicName::builtins(), PyEval_GetBuiltins()) < 0)
             goto error;
         /*
-         * Unpack an embedded ZIP file with more signature modules.
-         * They will be loaded later with the zipimporter.
-         * Due to MSVC's limitation to 64k strings, we need to assemble pieces.
+         * Pass the embedded archive of marshalled signature modules.
+         * It will be unmarshalled and imported from memory by the
+         * bootstrap module when needed.
          */
-        const char **block_ptr = (const char **)PySide_CompressedSignaturePackage;
-        int npieces = 0;
-        PyObject *piece, *zipped_string_sequence = PyList_New(0);
-        if (zipped_string_sequence == nullptr)
-            return nullptr;
-        for (; **block_ptr != 0; ++block_ptr) {
-            npieces++;
-            // we avoid the string/unicode dilemma by not using PyString_XXX:
-            piece = Py_BuildValue("s", *block_ptr);
-            if (piece == nullptr || PyList_Append(zipped_string_sequence, piece) < 0)
-                goto error;
-        }
-        if (PyDict_SetItemString(mdict, "zipstring_sequence", zipped_string_sequence) < 0)
+        char *archive_cast = reinterpret_cast<char *>(
+                                 const_cast<unsigned char *>(PySide_SignatureArchive));
+        AutoDecRef archive(PyBytes_FromStringAndSize(archive_cast,
+                                                     sizeof(PySide_SignatureArchive)));
+        if (archive.isNull()
+            || PyDict_SetItemString(mdict, "module_archive", archive) < 0)
             goto error;
-        Py_DECREF(zipped_string_sequence);
 
         // build a dict for diverse mappings
         p->map_dict = PyDict_New();
@@ -170,6 +173,11 @@ static safe_globals_struc *init_phase_1(PyMethodDef *init_meth)
         // This function will be disabled until phase 2 is done.
         p->finish_import_func = nullptr;
 
+        // Modules imported before phase 2 which need to be finished then.
+        p->pending_imports = PyList_New(0);
+        if (p->pending_imports == nullptr)
+            goto error;
+
         // Initialize the explicit init function.
         AutoDecRef init(PyCFunction_NewEx(init_meth, nullptr, nullptr));
         if (init.isNull()
@@ -208,6 +216,9 @@ static int init_phase_2(safe_globals_struc *p, PyMethodDef *methods)
         p->pyside_type_init_func = PyObject_GetAttrString(loader, "pyside_type_init");
         if (p->pyside_type_init_func == nullptr)
             goto error;
+        p->pyside_table_init_func = PyObject_GetAttrString(loader, "pyside_table_init");
+        if (p->pyside_table_init_func == nullptr)
+            goto error;
         p->create_signature_func = PyObject_GetAttrString(loader, "create_signature");
         if (p->create_signature_func == nullptr)
             goto error;
@@ -220,6 +231,17 @@ static int init_phase_2(safe_globals_struc *p, PyMethodDef *methods)
         p->finish_import_func = PyObject_GetAttrString(loader, "finish_import");
         if (p->finish_import_func == nullptr)
             goto error;
+        // Finish the imports that happened before, see lazy_signature_import().
+        Py_ssize_t n = PyList_Size(p->pending_imports);
+        for (Py_ssize_t i = 0; i < n; ++i) {
+            PyObject *module = PyList_GetItem(p->pending_imports, i);
+            AutoDecRef ret(PyObject_CallFunctionObjArgs(p->finish_import_func,
+                                                        module, nullptr));
+            if (ret.isNull())
+                goto error;
+        }
+        if (PyList_SetSlice(p->pending_imports, 0, n, nullptr) < 0)
+            goto error;
         return 0;
     }
 error:
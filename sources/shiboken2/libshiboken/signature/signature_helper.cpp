@@ -330,6 +330,60 @@ PyObject *_address_to_stringlist(PyObject *numkey)
     return res_list;
 }
 
+PyObject *_signature_table_to_args(PyObject *type_key, PyObject *capsule)
+{
+    /*
+     * Build the arguments for `pyside_table_init` from a signature table:
+     *
+     *     (type_key, types, [(funcname, multi, returntype, arglist), ...])
+     *
+     * The types are given by their index into the tuple `types`, where
+     * `multi` and `returntype` are None if missing. The arguments are
+     * tuples `(name, type, default)` with `default` being None if missing.
+     */
+    auto *table = reinterpret_cast<const PySideSignatureTable *>(
+                      PyCapsule_GetPointer(capsule, signatureTableName));
+    if (table == nullptr)
+        return nullptr;
+    AutoDecRef types(PyTuple_New(table->typeCount));
+    if (types.isNull())
+        return nullptr;
+    for (int i = 0; i < table->typeCount; ++i) {
+        PyObject *type = String::fromCString(table->types[i]);
+        if (type == nullptr)
+            return nullptr;
+        PyTuple_SET_ITEM(types.object(), i, type);
+    }
+    AutoDecRef functions(PyList_New(table->functionCount));
+    if (functions.isNull())
+        return nullptr;
+    for (int f = 0; f < table->functionCount; ++f) {
+        const PySideSignatureFunction &func = table->functions[f];
+        AutoDecRef arglist(PyTuple_New(func.argumentCount));
+        if (arglist.isNull())
+            return nullptr;
+        for (int a = 0; a < func.argumentCount; ++a) {
+            const PySideSignatureArgument &arg = func.arguments[a];
+            PyObject *argTuple = arg.defaultValue != nullptr
+                ? Py_BuildValue("(sis)", arg.name, arg.type, arg.defaultValue)
+                : Py_BuildValue("(siO)", arg.name, arg.type, Py_None);
+            if (argTuple == nullptr)
+                return nullptr;
+            PyTuple_SET_ITEM(arglist.object(), a, argTuple);
+        }
+        AutoDecRef multi(func.multi >= 0 ? PyLong_FromLong(func.multi)
+                                         : (Py_INCREF(Py_None), Py_None));
+        AutoDecRef returnType(func.returnType >= 0 ? PyLong_FromLong(func.returnType)
+                                                   : (Py_INCREF(Py_None), Py_None));
+        PyObject *funcTuple = Py_BuildValue("(sOOO)", func.name, multi.object(),
+                                            returnType.object(), arglist.object());
+        if (funcTuple == nullptr)
+            return nullptr;
+        PyList_SET_ITEM(functions.object(), f, funcTuple);
+    }
+    return Py_BuildValue("(OOO)", type_key, types.object(), functions.object());
+}
+
 static int _build_func_to_type(PyObject *obtype)
 {
     /*
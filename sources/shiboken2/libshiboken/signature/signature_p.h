@@ -53,8 +53,10 @@ typedef struct safe_globals_struc {
     PyObject *map_dict;
     PyObject *value_dict;       // for writing signatures
     PyObject *feature_dict;     // registry for PySide.support.__feature__
+    PyObject *pending_imports;  // modules imported before init part 2
     // init part 2: run module
     PyObject *pyside_type_init_func;
+    PyObject *pyside_table_init_func;
     PyObject *create_signature_func;
     PyObject *seterror_argument_func;
     PyObject *make_helptext_func;
@@ -100,6 +102,9 @@ PyObject *_get_class_of_cf(PyObject *ob_cf);
 PyObject *_get_class_of_sm(PyObject *ob_sm);
 PyObject *_get_class_of_descr(PyObject *ob);
 PyObject *_address_to_stringlist(PyObject *numkey);
+// Name of the capsules holding a PySideSignatureTable in arg_dict
+static const char signatureTableName[] = "PySideSignatureTable";
+PyObject *_signature_table_to_args(PyObject *type_key, PyObject *capsule);
 int _finish_nested_classes(PyObject *dict);
 
 } // extern "C"
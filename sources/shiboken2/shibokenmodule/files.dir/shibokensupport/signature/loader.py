@@ -52,13 +52,11 @@ This is meanwhile necessary to make the '__doc__' attribute work correctly.
 It does not mean that everything is initialized in advance. Only the modules
 are loaded completely after 'import PySide2'.
 
-This version uses both a normal directory, but has also an embedded ZIP file
-as a fallback solution. The ZIP file is generated by 'embedding_generator.py'
-and embedded into 'signature.cpp' as "embed/signature.inc".
-
-Meanwhile, the ZIP file grew so much, that MSVC had problems
-with it's 64k string limit, so we had to break the string up.
-See 'zipped_string_sequence' in signature.cpp.
+This version uses both a normal directory, but has also an embedded archive
+as a fallback solution. The archive of marshalled code objects is generated by
+'embedding_generator.py' and embedded into 'signature_globals.cpp' as
+"embed/signature_inc.h". It is imported from memory by the 'EmbeddedImporter'
+of 'signature_bootstrap.py'.
 """
 
 import sys
@@ -92,9 +90,25 @@ def formatannotation(annotation, base_module=None):
 # Note also that during the tests we have a different encoding that would
 # break the Python license decorated files without an encoding line.
 
+# The parser is only needed when signatures are requested. Since this does not
+# happen during an ordinary import, it is loaded on first use.
+parser = None
+
+def _import_parser():
+    global parser
+    if parser is None:
+        from shibokensupport.signature import parser
+        if "PySide2.support.signature" in sys.modules:
+            put_into_package(sys.modules["PySide2.support.signature"], parser)
+    return parser
+
 # name used in signature.cpp
 def pyside_type_init(type_key, sig_strings):
-    return parser.pyside_type_init(type_key, sig_strings)
+    return _import_parser().pyside_type_init(type_key, sig_strings)
+
+# name used in signature.cpp
+def pyside_table_init(type_key, types, functions):
+    return _import_parser().pyside_table_init(type_key, types, functions)
 
 # name used in signature.cpp
 def create_signature(props, key):
@@ -202,7 +216,8 @@ def move_into_pyside_package():
     put_into_package(PySide2.support.signature, errorhandler)
     put_into_package(PySide2.support.signature, layout)
     put_into_package(PySide2.support.signature, lib)
-    put_into_package(PySide2.support.signature, parser)
+    if parser is not None:
+        put_into_package(PySide2.support.signature, parser)
     put_into_package(PySide2.support.signature, importhandler)
     put_into_package(PySide2.support.signature.lib, enum_sig)
 
@@ -213,7 +228,6 @@ from shibokensupport.signature import mapping
 from shibokensupport.signature import errorhandler
 from shibokensupport.signature import layout
 from shibokensupport.signature import lib
-from shibokensupport.signature import parser
 from shibokensupport.signature import importhandler
 from shibokensupport.signature.lib import enum_sig
 
@@ -323,7 +323,11 @@ def handle_retvar(obj):
 
 def calculate_props(line):
     parsed = SimpleNamespace(**_parse_line(line.strip()))
-    arglist = parsed.arglist
+    return _calculate_props(parsed.funcname, parsed.multi, parsed.arglist,
+                            parsed.returntype, line)
+
+
+def _calculate_props(funcname, multi, arglist, returntype, line):
     annotations = {}
     _defaults = []
     for idx, tup in enumerate(arglist):
@@ -339,7 +343,6 @@ def calculate_props(line):
             default = _resolve_value(tup[2], ann, line)
             _defaults.append(default)
     defaults = tuple(_defaults)
-    returntype = parsed.returntype
     # PYSIDE-1383: We need to handle `None` explicitly.
     annotations["return"] = (_resolve_type(returntype, line, 0, handle_retvar)
                              if returntype is not None else None)
@@ -348,10 +351,9 @@ def calculate_props(line):
     props.kwdefaults = {}
     props.annotations = annotations
     props.varnames = varnames = tuple(tup[0] for tup in arglist)
-    funcname = parsed.funcname
     shortname = funcname[funcname.rindex(".")+1:]
     props.name = shortname
-    props.multi = parsed.multi
+    props.multi = multi
     fix_variables(props, line)
     return vars(props)
 
@@ -436,15 +438,35 @@ def fixup_multilines(lines):
     return res
 
 
-def pyside_type_init(type_key, sig_strings):
-    dprint()
-    dprint("Initialization of type key '{}'".format(type_key))
-    update_mapping()
-    lines = fixup_multilines(sig_strings)
+def _fix_keyword(name):
+    return name + "_" if name in keyword.kwlist else name
+
+
+def _table_props(types, function):
+    """
+    Calculate the properties of a function from a signature table.
+
+    The generator has already split the signature and removed duplicate
+    overloads, so only the keywords need to be handled.
+    """
+    funcname, multi, returntype, args = function
+    # Only used for warnings, therefore it is not reassembled exactly.
+    line = "{}(...)".format(funcname)
+    arglist = []
+    for name, type_index, default in args:
+        name = _fix_keyword(name)
+        ann = types[type_index]
+        arglist.append((name, ann) if default is None else (name, ann, default))
+    parts = funcname.rsplit(".", 1)
+    funcname = ".".join(parts[:-1] + [_fix_keyword(parts[-1])])
+    returntype = types[returntype] if returntype is not None else None
+    return _calculate_props(funcname, multi, arglist, returntype, line)
+
+
+def _collect_props(props_iter):
     ret = {}
     multi_props = []
-    for line in lines:
-        props = calculate_props(line)
+    for props in props_iter:
         shortname = props["name"]
         multi = props["multi"]
         if multi is None:
@@ -460,4 +482,19 @@ def pyside_type_init(type_key, sig_strings):
             multi_props = []
     return ret
 
+
+def pyside_type_init(type_key, sig_strings):
+    dprint()
+    dprint("Initialization of type key '{}'".format(type_key))
+    update_mapping()
+    lines = fixup_multilines(sig_strings)
+    return _collect_props(calculate_props(line) for line in lines)
+
+
+def pyside_table_init(type_key, types, functions):
+    dprint()
+    dprint("Initialization of type key '{}' from table".format(type_key))
+    update_mapping()
+    return _collect_props(_table_props(types, function) for function in functions)
+
 # end of file
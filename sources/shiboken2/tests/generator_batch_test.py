@@ -0,0 +1,135 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+#
+#############################################################################
+##
+## Copyright (C) 2020 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+
+'''Test cases for the batch mode of the generator.
+
+Usage: generator_batch_test.py <shiboken> <output-directory> <project-file>...
+       [-- <generator options>]
+
+Runs the generator in batch mode on the project files, listed in an order
+contradicting their dependencies. Checks that the modules are generated in
+dependency order and that the generated files are identical to those of the
+per-module generator runs of the build, found in the output directories
+specified by the project files.'''
+
+import os
+import re
+import shutil
+import subprocess
+import sys
+import unittest
+
+
+def project_output_directory(project_file):
+    with open(project_file) as f:
+        for line in f:
+            key, sep, value = line.partition('=')
+            if sep and key.strip() == 'output-directory':
+                return value.strip()
+    return None
+
+
+def collect_files(directory):
+    result = []
+    for root, dirs, files in os.walk(directory):
+        for name in files:
+            path = os.path.join(root, name)
+            result.append(os.path.relpath(path, directory))
+    return sorted(result)
+
+
+class GeneratorBatchTest(unittest.TestCase):
+
+    shiboken = None
+    output_directory = None
+    project_files = []
+    options = []
+
+    @classmethod
+    def setUpClass(cls):
+        if os.path.isdir(cls.output_directory):
+            shutil.rmtree(cls.output_directory)
+        os.makedirs(cls.output_directory)
+        project_files = os.pathsep.join(cls.project_files)
+        command = ([cls.shiboken, '--batch=' + project_files,
+                    '--output-directory=' + cls.output_directory] + cls.options)
+        process = subprocess.Popen(command, stdout=subprocess.PIPE,
+                                   universal_newlines=True)
+        cls.output = process.communicate()[0]
+        cls.returncode = process.returncode
+
+    def testExitCode(self):
+        self.assertEqual(self.returncode, 0, self.output)
+
+    def testOrder(self):
+        # "Done, (<module>) ..." is printed after generating a module
+        done = re.findall(r'^Done, \((\w+)\)', self.output, re.MULTILINE)
+        self.assertEqual(sorted(done), ['minimal', 'other', 'sample', 'smart'], self.output)
+        self.assertLess(done.index('sample'), done.index('other'))
+        self.assertLess(done.index('smart'), done.index('other'))
+
+    def testGeneratedFiles(self):
+        references = [project_output_directory(p) for p in self.project_files]
+        packages = [p for p in os.listdir(self.output_directory)
+                    if os.path.isdir(os.path.join(self.output_directory, p))]
+        self.assertEqual(len(packages), len(self.project_files), packages)
+        for package in packages:
+            matching = [r for r in references if os.path.isdir(os.path.join(r, package))]
+            self.assertEqual(len(matching), 1, package)
+            reference = matching[0]
+            reference_package = os.path.join(reference, package)
+            batch_package = os.path.join(self.output_directory, package)
+            files = collect_files(batch_package)
+            self.assertTrue(files, package)
+            self.assertEqual(files, collect_files(reference_package), package)
+            for name in files:
+                with open(os.path.join(batch_package, name), 'rb') as f:
+                    generated = f.read()
+                with open(os.path.join(reference_package, name), 'rb') as f:
+                    expected = f.read()
+                # Paths of the output directory might end up in the code
+                generated = generated.replace(self.output_directory.encode('utf-8'),
+                                              reference.encode('utf-8'))
+                self.assertEqual(generated, expected, os.path.join(package, name))
+
+
+if __name__ == '__main__':
+    args = sys.argv[1:]
+    options = []
+    if '--' in args:
+        options = args[args.index('--') + 1:]
+        args = args[:args.index('--')]
+    GeneratorBatchTest.shiboken = args[0]
+    GeneratorBatchTest.output_directory = os.path.abspath(args[1])
+    GeneratorBatchTest.project_files = args[2:]
+    GeneratorBatchTest.options = options
+    unittest.main(argv=sys.argv[:1])
@@ -62,3 +62,8 @@ OtherDerived::unpureVirtual()
 void OtherDerived::pureVirtualPrivate()
 {
 }
+
+Abstract* createOtherDerived()
+{
+    return new OtherDerived(200);
+}
@@ -34,6 +34,7 @@
 #include "derived.h"
 #include "objecttype.h"
 #include "complex.h"
+#include "number.h"
 
 class ObjectType;
 
@@ -52,6 +53,11 @@ public:
     inline Complex useValueTypeFromOtherModule(const Complex& c) { return c; }
     inline void useEnumTypeFromOtherModule(OverloadedFuncEnum) {}
 
+    // Default arguments of primitive, wrapper and object types
+    inline double sumDefaultArguments(int i, double d = 0.5, const Complex& c = Complex(),
+                                      const Number& n = Number(0), ObjectType* obj = nullptr)
+    { return i + d + c.real() + n.value() + (obj ? 100 : 0); }
+
     // factory method
     static Abstract* createObject();
 
@@ -64,5 +70,9 @@ protected:
 private:
     void pureVirtualPrivate() override;
 };
+
+// Returns an OtherDerived through its base class from another module
+LIBOTHER_API Abstract* createOtherDerived();
+
 #endif // OTHERDERIVED_H
 
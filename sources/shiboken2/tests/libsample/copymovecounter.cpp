@@ -0,0 +1,79 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of Qt for Python.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "copymovecounter.h"
+
+static int copyCount = 0;
+static int moveCount = 0;
+
+CopyMoveCounter::CopyMoveCounter(const CopyMoveCounter &other) : m_value(other.m_value)
+{
+    ++copyCount;
+}
+
+CopyMoveCounter::CopyMoveCounter(CopyMoveCounter &&other) noexcept : m_value(other.m_value)
+{
+    other.m_value = 0;
+    ++moveCount;
+}
+
+CopyMoveCounter &CopyMoveCounter::operator=(const CopyMoveCounter &other)
+{
+    m_value = other.m_value;
+    ++copyCount;
+    return *this;
+}
+
+CopyMoveCounter &CopyMoveCounter::operator=(CopyMoveCounter &&other) noexcept
+{
+    m_value = other.m_value;
+    other.m_value = 0;
+    ++moveCount;
+    return *this;
+}
+
+CopyMoveCounter CopyMoveCounter::create(int value)
+{
+    return CopyMoveCounter(value);
+}
+
+int CopyMoveCounter::copies()
+{
+    return copyCount;
+}
+
+int CopyMoveCounter::moves()
+{
+    return moveCount;
+}
+
+void CopyMoveCounter::resetCounters()
+{
+    copyCount = 0;
+    moveCount = 0;
+}
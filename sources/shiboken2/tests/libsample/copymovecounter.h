@@ -0,0 +1,57 @@
+/****************************************************************************
+**
+** Copyright (C) 2020 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the test suite of Qt for Python.
+**
+** $QT_BEGIN_LICENSE:GPL-EXCEPT$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 3 as published by the Free Software
+** Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef COPYMOVECOUNTER_H
+#define COPYMOVECOUNTER_H
+
+#include "libsamplemacros.h"
+
+// Counts the copies and moves of its instances.
+class LIBSAMPLE_API CopyMoveCounter
+{
+public:
+    explicit CopyMoveCounter(int value = 0) : m_value(value) {}
+    CopyMoveCounter(const CopyMoveCounter &other);
+    CopyMoveCounter(CopyMoveCounter &&other) noexcept;
+    CopyMoveCounter &operator=(const CopyMoveCounter &other);
+    CopyMoveCounter &operator=(CopyMoveCounter &&other) noexcept;
+    ~CopyMoveCounter() = default;
+
+    int value() const { return m_value; }
+
+    static CopyMoveCounter create(int value);
+
+    static int copies();
+    static int moves();
+    static void resetCounters();
+
+private:
+    int m_value;
+};
+
+#endif // COPYMOVECOUNTER_H
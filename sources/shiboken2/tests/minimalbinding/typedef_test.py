@@ -29,6 +29,7 @@
 ##
 #############################################################################
 
+import array
 import os
 import sys
 import unittest
@@ -65,6 +66,14 @@ class TypedefTest(unittest.TestCase):
         self.assertTrue(arrayFuncInt(np.array(none)), "None is empty, arrayFuncInt should return true")
         self.assertFalse(arrayFuncInt(np.array(full)), "Full is NOT empty, arrayFuncInt should return false")
 
+    def test_arrayFuncIntBuffer(self):
+        self.assertTrue(arrayFuncInt(array.array('i')), "Empty buffer, arrayFuncInt should return true")
+        self.assertFalse(arrayFuncInt(array.array('i', range(self.the_size))),
+                         "Full buffer, arrayFuncInt should return false")
+
+        self.assertFalse(arrayFuncInt(np.arange(self.the_size, dtype=np.intc)),
+                         "Full buffer, arrayFuncInt should return false")
+
     def test_arrayFuncIntTypedef(self):
         none = ()
         full = (1, 2, 3)
@@ -80,6 +89,15 @@ class TypedefTest(unittest.TestCase):
         self.assertTrue((len(none) == 0), "none should be empty")
         self.assertTrue((len(full) == self.the_size), "full should have " + str(self.the_size) + " elements")
 
+    @unittest.skipUnless(IS_PY3K, "requires memoryview.cast()")
+    def test_arrayFuncIntReturnBuffer(self):
+        full = arrayFuncIntReturn(self.the_size)
+        self.assertIsInstance(full, memoryview)
+        self.assertEqual(full.format, 'i')
+        self.assertEqual(full.tolist(), [0] * self.the_size)
+        self.assertFalse(arrayFuncInt(full), "Full is NOT empty, arrayFuncInt should return false")
+        self.assertEqual(np.asarray(full).dtype, np.intc)
+
     def test_arrayFuncIntReturnTypedef(self):
         none = arrayFuncIntReturnTypedef(0)
         full = arrayFuncIntReturnTypedef(self.the_size)
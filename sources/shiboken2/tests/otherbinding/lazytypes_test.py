@@ -0,0 +1,107 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+#
+#############################################################################
+##
+## Copyright (C) 2020 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+
+'''Test cases for the types of a module created on first access.
+
+The 'other' test binding is generated with --lazy-type-initialization.
+Each test uses types which the other tests do not touch, so that they do
+not depend on the order of execution.'''
+
+import os
+import sys
+import types
+import unittest
+
+sys.path.append(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+from shiboken_paths import init_paths
+init_paths()
+
+import other
+from sample import Abstract, Base1, Base2, MDerived1, ObjectType
+
+# Python versions older than 3.7 have no module __getattr__, so all types
+# are created at import there.
+CREATED_ON_ACCESS = sys.version_info >= (3, 7)
+
+
+def isCreated(name):
+    return name in vars(other)
+
+
+class LazyTypesTest(unittest.TestCase):
+
+    def testAccessByName(self):
+        if CREATED_ON_ACCESS:
+            self.assertFalse(isCreated('Number'))
+        self.assertIn('Number', dir(other))
+        self.assertIn('Number', other.__all__)
+        number = other.Number(5)
+        self.assertTrue(isCreated('Number'))
+        self.assertEqual(number.value(), 5)
+        self.assertIs(getattr(other, 'Number'), type(number))
+        from other import Number
+        self.assertIs(Number, type(number))
+        with self.assertRaises(AttributeError):
+            other.NoSuchType
+
+    def testCrossModuleBaseClasses(self):
+        if CREATED_ON_ACCESS:
+            self.assertFalse(isCreated('OtherMultipleDerived'))
+        self.assertTrue(issubclass(other.OtherMultipleDerived, MDerived1))
+        obj = other.OtherMultipleDerived()
+        self.assertTrue(isinstance(obj, Base1))
+        self.assertTrue(isinstance(obj, Base2))
+        self.assertEqual(obj.mderived1Method(), MDerived1().mderived1Method())
+        self.assertTrue(issubclass(other.OtherObjectType, ObjectType))
+
+    def testIsInstanceBeforeFirstAccess(self):
+        if CREATED_ON_ACCESS:
+            self.assertFalse(isCreated('OtherDerived'))
+        # The type discovery of the returned Abstract creates OtherDerived.
+        obj = other.createOtherDerived()
+        self.assertTrue(isCreated('OtherDerived'))
+        self.assertTrue(isinstance(obj, other.OtherDerived))
+        self.assertTrue(isinstance(obj, Abstract))
+        self.assertIs(type(obj), other.OtherDerived)
+        self.assertEqual(obj.id_(), 200)
+
+    def testStarImport(self):
+        names = set(other.__all__)
+        self.assertIn('OtherObjectType', names)
+        self.assertIn('createOtherDerived', names)
+        self.assertFalse(any(name.startswith('_') for name in names))
+        namespace = {}
+        exec('from other import *', namespace)
+        for name in names:
+            self.assertIn(name, namespace)
+            self.assertNotIsInstance(namespace[name], types.ModuleType)
+
+
+if __name__ == '__main__':
+    unittest.main()
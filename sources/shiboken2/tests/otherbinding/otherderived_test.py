@@ -39,7 +39,8 @@ sys.path.append(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
 from shiboken_paths import init_paths
 init_paths()
 
-from sample import Abstract, Derived
+import shiboken2 as shiboken
+from sample import Abstract, Derived, ObjectType
 from other import OtherDerived, Number
 
 class Multiple(Derived, Number):
@@ -120,6 +121,41 @@ class OtherDerivedTest(unittest.TestCase):
         d = OtherDerived(objId)
         self.assertEqual(Abstract.getObjectId(d), objId)
 
+class DefaultArgumentsTest(unittest.TestCase):
+    '''Test case for the keyword arguments of OtherDerived.sumDefaultArguments()
+       (the other binding uses compact argument parsing)'''
+
+    def setUp(self):
+        self.d = OtherDerived()
+
+    def testPositionalArguments(self):
+        result = self.d.sumDefaultArguments(1, 2.0, complex(3, 0), Number(4), ObjectType())
+        self.assertEqual(result, 110)
+
+    def testKeywordArguments(self):
+        self.assertEqual(self.d.sumDefaultArguments(1), 1.5)
+        self.assertEqual(self.d.sumDefaultArguments(1, n=Number(4), c=complex(3, 0)), 8.5)
+        self.assertEqual(self.d.sumDefaultArguments(1, 2.0, obj=ObjectType()), 103)
+        self.assertEqual(self.d.sumDefaultArguments(1, d=2), 3)
+
+    def testKeywordArgumentOfWrongType(self):
+        self.assertRaises(TypeError, self.d.sumDefaultArguments, 1, d='x')
+        self.assertRaises(TypeError, self.d.sumDefaultArguments, 1, n=4)
+        self.assertRaises(TypeError, self.d.sumDefaultArguments, 1, obj=Number(4))
+
+    def testArgumentPassedTwice(self):
+        self.assertRaises(TypeError, self.d.sumDefaultArguments, 1, 2.0, d=3.0)
+
+    def testUnknownKeywordArgument(self):
+        self.assertRaises(TypeError, self.d.sumDefaultArguments, 1, e=3.0)
+
+    def testDeletedObjectArgument(self):
+        obj = ObjectType()
+        shiboken.delete(obj)
+        self.assertRaises(RuntimeError, self.d.sumDefaultArguments, 1, obj=obj)
+        self.assertRaises(RuntimeError, self.d.sumDefaultArguments, 1, 2.0, complex(3, 0),
+                          Number(4), obj)
+
 if __name__ == '__main__':
     unittest.main()
 
@@ -30,6 +30,7 @@
 
 '''Test case for Array types (PySequence).'''
 
+import array
 import os
 import sys
 import unittest
@@ -55,5 +56,28 @@ class ArrayTester(unittest.TestCase):
         doubleList = [1.2, 2.3, 3.4, 4.5]
         self.assertEqual(sample.sumDoubleArray(doubleList), 11.4)
 
+    def testIntTuple(self):
+        self.assertEqual(sample.sumIntArray((1, 2, 3, 4)), 10)
+
+    def testIntArrayLimits(self):
+        # Values of one and two digits of the int representation
+        values = [-1, 0, 2**30 - 1, -2**30 - 1, 2**30, -2**31, 2**31 - 1]
+        self.assertEqual(sample.sumIntArray(values), sum(values))
+        self.assertEqual(sample.sumIntArray([True, 2]), 3)
+
+    def testMixedIntArray(self):
+        self.assertRaises(TypeError, sample.sumIntArray, [1, 2, 3.4, 4])
+
+    @unittest.skipUnless(sys.version_info[0] >= 3, "requires the new buffer protocol")
+    def testIntBuffer(self):
+        intArray = array.array('i', [1, 2, 3, 4])
+        self.assertEqual(sample.sumIntArray(intArray), 10)
+        self.assertEqual(sample.sumIntArray(memoryview(intArray)), 10)
+
+    @unittest.skipUnless(sys.version_info[0] >= 3, "requires the new buffer protocol")
+    def testDoubleBuffer(self):
+        doubleArray = array.array('d', [1.2, 2.3, 3.4, 4.5])
+        self.assertEqual(sample.sumDoubleArray(doubleArray), 11.4)
+
 if __name__ == '__main__':
     unittest.main()
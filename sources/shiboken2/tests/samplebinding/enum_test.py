@@ -43,7 +43,7 @@ import shiboken2
 # This is needed after the introduction of BUILD_DIR.
 
 import sample
-from sample import SampleNamespace, ObjectType, Event
+from sample import Abstract, SampleNamespace, ObjectType, Event
 from py3kcompat import IS_PY3K, b
 
 def createTempFile():
@@ -176,6 +176,43 @@ class EnumOverloadTest(unittest.TestCase):
         self.assertEqual(o.callWithEnum('', Event.ANY_EVENT, 9), 81)
         self.assertEqual(o.callWithEnum('', 9), 9)
 
+class EnumItemAccessTest(unittest.TestCase):
+    '''Enum items are created on first access, test the ways to reach them.'''
+
+    def testInstanceAccess(self):
+        event = Event(Event.NO_EVENT)
+        self.assertEqual(event.SOME_EVENT, Event.SOME_EVENT)
+
+    def testSubclassAccess(self):
+        self.assertEqual(MyEvent.BASIC_EVENT, Event.BASIC_EVENT)
+        self.assertEqual(MyEvent.EventType.BASIC_EVENT, Event.BASIC_EVENT)
+
+    def testItemFromValue(self):
+        self.assertEqual(repr(Event.EventType(2)), 'sample.Event.EventType.SOME_EVENT')
+        self.assertEqual(Event.EventType(3), Event.ANY_EVENT)
+
+    def testDicts(self):
+        names = ['NO_EVENT', 'BASIC_EVENT', 'SOME_EVENT', 'ANY_EVENT']
+        self.assertEqual(sorted(Event.EventType.values), sorted(names))
+        for name in names:
+            self.assertIn(name, Event.__dict__)
+            self.assertIn(name, Event.EventType.__dict__)
+            self.assertIn(name, dir(Event))
+
+    def testValuesOrder(self):
+        '''"values" keeps the declaration order, not the order of the values.'''
+        names = ['Short', 'Verbose', 'OnlyId', 'ClassNameAndId',
+                 'DummyItemToTestPrivateEnum1', 'DummyItemToTestPrivateEnum2']
+        self.assertEqual(list(Abstract.PrintFormat.values), names)
+        self.assertEqual(Abstract.PrintFormat(1), Abstract.Verbose)
+        self.assertEqual(repr(Abstract.PrintFormat(3)), 'sample.Abstract.PrintFormat.ClassNameAndId')
+
+    def testMissingItem(self):
+        self.assertFalse(hasattr(Event, 'NO_SUCH_EVENT'))
+        self.assertFalse(hasattr(Event.EventType, 'NO_SUCH_EVENT'))
+        self.assertRaises(AttributeError, getattr, Event(Event.NO_EVENT), 'NO_SUCH_EVENT')
+
+
 class EnumOperators(unittest.TestCase):
     '''Test case for operations on enums'''
 
@@ -32,6 +32,7 @@
 #include "bucket.h"
 #include "collector.h"
 #include "complex.h"
+#include "copymovecounter.h"
 #include "ctorconvrule.h"
 #include "cvlist.h"
 #include "sbkdate.h"
@@ -120,10 +120,32 @@ class IntImplicitConvert(NumericTester):
         self.check_value(3, 3, sample.acceptULong, long)
         self.assertRaises(OverflowError, sample.acceptULong, -3)
 
+    def testIntLimits(self):
+        '''Int at the limits of the C++ types'''
+        self.check_value(cIntMax, cIntMax, sample.acceptInt, int)
+        self.check_value(cIntMin, cIntMin, sample.acceptInt, int)
+        self.check_value(-1, -1, sample.acceptInt, int)
+        self.assertRaises(OverflowError, sample.acceptInt, cIntMax + 1)
+        self.assertRaises(OverflowError, sample.acceptInt, cIntMin - 1)
+        self.check_value(2 * cIntMax + 1, 2 * cIntMax + 1, sample.acceptUInt, long)
+        self.assertRaises(OverflowError, sample.acceptUInt, 2 * cIntMax + 2)
+        self.assertRaises(OverflowError, sample.acceptUInt, -1)
+
+    def testBoolAsInt(self):
+        '''Bool as Int'''
+        self.check_value(True, 1, sample.acceptInt, int)
+        self.check_value(False, 0, sample.acceptInt, int)
+
     def testFloatAsDouble(self):
         '''Float as double'''
         self.check_value(3.14, 3.14, sample.acceptDouble, float)
 
+    def testFloatSubclassAsDouble(self):
+        '''Float subclass as double'''
+        class Float(float):
+            pass
+        self.check_value(Float(2.5), 2.5, sample.acceptDouble, float)
+
 
 class LongImplicitConvert(NumericTester):
     '''Test case for implicit converting C++ numeric types.'''
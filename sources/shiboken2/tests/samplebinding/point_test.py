@@ -31,6 +31,7 @@
 
 '''Test cases for Point class'''
 
+import gc
 import os
 import sys
 import unittest
@@ -39,6 +40,7 @@ sys.path.append(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
 from shiboken_paths import init_paths
 init_paths()
 
+import shiboken2 as shiboken
 from sample import Point
 from py3kcompat import unicode
 
@@ -113,5 +115,61 @@ class PointTest(unittest.TestCase):
         expected = Point((pt1.x() + pt2.x()) / 2.0, (pt1.y() + pt2.y()) / 2.0)
         self.assertEqual(pt1.midpoint(pt2), expected)
 
+
+class PointSubclass(Point):
+    def __init__(self, x, y):
+        Point.__init__(self, x, y)
+        self.name = 'sub'
+
+
+class InlineStorageTest(unittest.TestCase):
+    '''Point is constructed inside its wrapper (inline-storage="yes").'''
+
+    def testCopiesAreIndependent(self):
+        points = [Point(float(i), 0.5) for i in range(100)]
+        copies = [pt.copy() for pt in points]
+        for pt in points:
+            pt += Point(1.0, 1.0)
+        for i, pt in enumerate(copies):
+            self.assertEqual(pt, Point(float(i), 0.5))
+
+    def testSubclass(self):
+        pt = PointSubclass(1.0, 2.0)
+        self.assertEqual(pt.name, 'sub')
+        self.assertEqual(pt + Point(1.0, 1.0), Point(2.0, 3.0))
+
+    def testInitializeTwice(self):
+        pt = Point(1.0, 2.0)
+        self.assertRaises(RuntimeError, pt.__init__, 3.0, 4.0)
+        self.assertEqual(pt, Point(1.0, 2.0))
+
+    def testDelete(self):
+        pt = Point(1.0, 2.0)
+        shiboken.delete(pt)
+        self.assertFalse(shiboken.isValid(pt))
+        self.assertRaises(RuntimeError, pt.x)
+
+
+class FreeListTest(unittest.TestCase):
+    '''Point recycles its wrappers (free-list-size) and is not tracked by the GC.'''
+
+    def testRecycledWrappers(self):
+        for i in range(100):
+            points = [Point(float(i), float(j)) for j in range(32)]
+            for j, pt in enumerate(points):
+                self.assertEqual(pt, Point(float(i), float(j)))
+            del points
+
+    def testRecycledWrapperHasNoAttributes(self):
+        pt = Point(1.0, 2.0)
+        pt.name = 'first'
+        del pt
+        pt = Point(1.0, 2.0)
+        self.assertFalse(hasattr(pt, 'name'))
+
+    def testGcTracking(self):
+        self.assertFalse(gc.is_tracked(Point(1.0, 2.0)))
+        self.assertTrue(gc.is_tracked(PointSubclass(1.0, 2.0)))
+
 if __name__ == '__main__':
     unittest.main()
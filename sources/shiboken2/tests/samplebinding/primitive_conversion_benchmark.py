@@ -0,0 +1,82 @@
+#!/usr/bin/env python
+# -*- coding: utf-8 -*-
+#
+#############################################################################
+##
+## Copyright (C) 2016 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+'''Measures the conversion of Python numbers to C++ int and double arguments.
+
+Usage:
+
+    python primitive_conversion_benchmark.py [--count N] [--repeat N]
+
+Calls functions of the sample binding taking int, unsigned int and double
+arguments N times (1000000 by default), passing Python ints and floats, and
+reports the fastest of the repeated runs.
+'''
+
+import argparse
+import os
+import sys
+import timeit
+
+sys.path.append(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+from shiboken_paths import init_paths
+init_paths()
+
+from sample import Point, acceptDouble, acceptInt, acceptUInt, overloadedFunc
+
+
+def measure(function, args, count, repeat):
+    return min(timeit.repeat(lambda: function(*args), number=count, repeat=repeat))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--count", type=int, default=1000 * 1000,
+                        help="number of calls per function")
+    parser.add_argument("--repeat", type=int, default=3,
+                        help="number of runs of which the fastest is reported")
+    args = parser.parse_args()
+
+    benchmarks = [("acceptInt(int)", acceptInt, (42,)),
+                  ("acceptInt(float)", acceptInt, (42.5,)),
+                  ("acceptUInt(int)", acceptUInt, (42,)),
+                  ("acceptDouble(float)", acceptDouble, (42.5,)),
+                  ("acceptDouble(int)", acceptDouble, (42,)),
+                  ("overloadedFunc(int)", overloadedFunc, (42,)),
+                  ("overloadedFunc(float)", overloadedFunc, (42.5,)),
+                  ("Point(int, int)", Point, (1, 2)),
+                  ("Point(float, float)", Point, (1.5, 2.5))]
+    for name, function, arguments in benchmarks:
+        print("{:30} {:>8} {:>11.3f}s".format(name, args.count,
+                                              measure(function, arguments, args.count, args.repeat)))
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,78 @@
+#############################################################################
+##
+## Copyright (C) 2020 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+
+'''Test cases for the import time profiling of the shiboken module.'''
+
+import json
+import os
+import sys
+import tempfile
+import unittest
+
+sys.path.append(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+from shiboken_paths import init_paths
+init_paths()
+
+import shiboken2 as shiboken
+shiboken.setImportProfilingEnabled(True)
+import minimal
+shiboken.setImportProfilingEnabled(False)
+
+
+class ImportProfileTest(unittest.TestCase):
+    def testReport(self):
+        report = shiboken.importProfile()
+        self.assertIn("minimal", report)
+        module = report["minimal"]
+        self.assertIn("module", module["minimal"])
+        self.assertIn("class", module["Obj"])
+        self.assertIn("converters", module["Obj"])
+        self.assertIn("signatures", module["Obj"])
+        self.assertIn("enum", module["Val.ValEnum"])
+        # The class initialization is contained in the module initialization.
+        self.assertGreaterEqual(module["minimal"]["module"], module["Obj"]["class"])
+
+    def testChromeTrace(self):
+        handle, fileName = tempfile.mkstemp(suffix=".json")
+        os.close(handle)
+        try:
+            self.assertTrue(shiboken.dumpImportProfile(fileName))
+            with open(fileName) as f:
+                trace = json.load(f)
+        finally:
+            os.remove(fileName)
+        events = trace["traceEvents"]
+        self.assertTrue(events)
+        self.assertTrue(all(event["ph"] == "X" for event in events))
+        names = [event["name"] for event in events if event["args"]["module"] == "minimal"]
+        self.assertIn("Obj", names)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,73 @@
+#############################################################################
+##
+## Copyright (C) 2020 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+
+'''Test cases for the memory report of the shiboken module.'''
+
+import os
+import sys
+import unittest
+
+sys.path.append(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+from shiboken_paths import init_paths
+init_paths()
+
+import shiboken2 as shiboken
+from sample import ObjectModel, ObjectType, ObjectView
+
+
+class MemoryReportTest(unittest.TestCase):
+    def testWrapperCounts(self):
+        before = shiboken.memoryReport()["types"].get("sample.ObjectType", 0)
+        objects = [ObjectType() for i in range(3)]
+        report = shiboken.memoryReport()
+        self.assertEqual(report["types"]["sample.ObjectType"], before + 3)
+        self.assertGreaterEqual(report["wrappers"], 3)
+        bytes = report["bytes"]
+        self.assertEqual(bytes["total"], bytes["SbkObjectPrivate"] + bytes["ParentInfo"]
+                         + bytes["RefCountList"])
+        del objects
+
+    def testTrees(self):
+        root = ObjectType()
+        child = ObjectType(root)
+        ObjectType(child)
+        trees = shiboken.memoryReport(1)["trees"]
+        self.assertEqual(len(trees), 1)
+        self.assertEqual(trees[0], (root, 3))
+
+    def testReferences(self):
+        model = ObjectModel()
+        view = ObjectView()
+        view.setModel(model)
+        references = shiboken.memoryReport()["references"]
+        self.assertGreaterEqual(references["setModel(ObjectModel*)1"], 1)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,129 @@
+#############################################################################
+##
+## Copyright (C) 2020 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+
+"""
+array_benchmark.py
+==================
+
+Measures the conversion of Python sequences and buffers to C++ arrays.
+
+Usage:
+------
+
+    python array_benchmark.py [--count N] [--size N] [--repeat N]
+
+Creates QMatrix4x4 instances from sequences of 16 floats, passes arrays of
+floats to QOpenGLShaderProgram.setUniformValueArray() (the glUniform*v family)
+and creates QPolygonF instances from N points (1 million by default). Each
+input is passed as a list, a tuple, an array.array and a memoryview.
+"""
+
+import array
+import sys
+
+from benchmark_utils import argument_parser, measure
+
+from PySide2.QtCore import QPointF
+from PySide2.QtGui import (QGuiApplication, QMatrix4x4, QOffscreenSurface,
+                           QOpenGLContext, QOpenGLShaderProgram, QPolygonF)
+
+
+def inputs(typecode, values):
+    data = array.array(typecode, values)
+    return [("list", list(data)), ("tuple", tuple(data)),
+            ("array", data), ("memoryview", memoryview(data))]
+
+
+def matrix_construction(value):
+    def run(count):
+        for i in range(count):
+            QMatrix4x4(value)
+    return run
+
+
+def uniform_array(program, value, size):
+    def run(count):
+        for i in range(count):
+            program.setUniformValueArray(0, value, size, 1)
+    return run
+
+
+def polygon_construction(value):
+    def run(count):
+        for i in range(count):
+            QPolygonF(value)
+    return run
+
+
+def create_shader_program():
+    """Return a shader program bound to an offscreen context or None."""
+    surface = QOffscreenSurface()
+    surface.create()
+    context = QOpenGLContext()
+    if not context.create() or not context.makeCurrent(surface):
+        return None, None
+    program = QOpenGLShaderProgram(context)
+    program.bind()
+    return program, (surface, context)
+
+
+def report(name, function_factory, values, count, repeat):
+    for kind, value in values:
+        print("{:28} {:12} {:>11.3f}s".format(name, kind,
+                                             measure(function_factory(value), count, repeat)))
+
+
+def main():
+    parser = argument_parser(__doc__, 100 * 1000, "number of calls for the small arrays")
+    parser.add_argument("--size", type=int, default=1000 * 1000,
+                        help="number of elements of the large arrays")
+    args = parser.parse_args()
+
+    app = QGuiApplication(sys.argv)
+
+    report("QMatrix4x4(sequence)", matrix_construction,
+           inputs('f', range(16)), args.count, args.repeat)
+
+    program, keep_alive = create_shader_program()
+    if program:
+        large = inputs('f', range(args.size))
+        report("setUniformValueArray()", lambda v: uniform_array(program, v, args.size),
+               large, 10, args.repeat)
+    else:
+        print("setUniformValueArray(): no OpenGL context available, skipped")
+
+    points = array.array('d', range(2 * args.size))
+    polygons = [("list", [QPointF(points[i], points[i + 1]) for i in range(0, len(points), 2)]),
+                ("array", points), ("memoryview", memoryview(points))]
+    report("QPolygonF({} points)".format(args.size), polygon_construction,
+           polygons, 10, args.repeat)
+
+
+if __name__ == "__main__":
+    main()
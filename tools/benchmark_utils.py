@@ -0,0 +1,64 @@
+#############################################################################
+##
+## Copyright (C) 2020 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+
+
+"""
+benchmark_utils.py
+==================
+
+Helpers shared by the *_benchmark.py scripts of this directory.
+
+Each benchmark is a function taking the number of iterations. It is run
+several times and the fastest run is reported, which is the least disturbed
+by other activity on the machine.
+"""
+
+import argparse
+import timeit
+
+DEFAULT_REPEAT = 3
+
+
+def argument_parser(description, count, count_help):
+    """Return a parser for the --count and --repeat options."""
+    parser = argparse.ArgumentParser(description=description,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--count", type=int, default=count, help=count_help)
+    parser.add_argument("--repeat", type=int, default=DEFAULT_REPEAT,
+                        help="number of runs of which the fastest is reported")
+    return parser
+
+
+def measure(function, count, repeat=DEFAULT_REPEAT):
+    """Return the time in seconds of the fastest call of function(count)."""
+    return min(timeit.repeat(lambda: function(count), number=1, repeat=repeat))
+
+
+def report(name, count, seconds):
+    print("{:30} {:>8} {:>11.3f}s".format(name, count, seconds))
@@ -0,0 +1,96 @@
+#############################################################################
+##
+## Copyright (C) 2020 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+
+"""
+qstring_benchmark.py
+====================
+
+Measures the conversion between Python str and QString.
+
+Usage:
+------
+
+    python qstring_benchmark.py [--count N] [--repeat N]
+
+The strings are converted N times (10 million by default) through
+QObject.setObjectName()/objectName() and through the data() of a
+QStandardItemModel, for short and long strings of each character size
+(ASCII, Latin-1, UCS-2 and characters outside the BMP).
+"""
+
+from benchmark_utils import argument_parser, measure
+
+from PySide2.QtCore import QObject, Qt
+from PySide2.QtGui import QStandardItemModel
+
+STRINGS = [
+    ("ascii", u"objectName"),
+    ("latin-1", u"\xfcmlaut name"),
+    ("ucs-2", u"\u20ac price tag"),
+    ("ucs-4", u"\U0001f632 surprised"),
+]
+
+LONG_FACTOR = 100
+
+
+def object_name_round_trip(value):
+    obj = QObject()
+
+    def run(count):
+        for i in range(count):
+            obj.setObjectName(value)
+            obj.objectName()
+    return run
+
+
+def model_data_round_trip(value):
+    model = QStandardItemModel(1, 1)
+    index = model.index(0, 0)
+
+    def run(count):
+        for i in range(count):
+            model.setData(index, value, Qt.DisplayRole)
+            model.data(index, Qt.DisplayRole)
+    return run
+
+
+def main():
+    args = argument_parser(__doc__, 10 * 1000 * 1000,
+                           "number of round trips per string").parse_args()
+
+    print("{:10} {:8} {:>12} {:>12}".format("kind", "length", "objectName", "model data"))
+    for kind, text in STRINGS:
+        for value in (text, text * LONG_FACTOR):
+            times = [measure(factory(value), args.count, args.repeat)
+                     for factory in (object_name_round_trip, model_data_round_trip)]
+            print("{:10} {:8} {:>11.3f}s {:>11.3f}s".format(kind, len(value), *times))
+
+
+if __name__ == "__main__":
+    main()
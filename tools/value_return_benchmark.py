@@ -0,0 +1,115 @@
+#############################################################################
+##
+## Copyright (C) 2020 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+
+
+"""
+value_return_benchmark.py
+=========================
+
+Measures functions returning value types by value, which are moved into
+the Python wrapper instead of being copied.
+
+Usage:
+------
+
+    python value_return_benchmark.py [--count N] [--repeat N]
+
+Calls QImage.scaled() and a number of QPainterPath operations returning new
+paths N times (100000 by default).
+"""
+
+import sys
+
+from benchmark_utils import argument_parser, measure, report
+
+from PySide2.QtCore import QPointF, QRectF, Qt
+from PySide2.QtGui import QGuiApplication, QImage, QPainterPath, QTransform
+
+
+def image_scaled(size):
+    image = QImage(size, size, QImage.Format_ARGB32)
+    image.fill(Qt.red)
+
+    def run(count):
+        for i in range(count):
+            image.scaled(size // 2, size // 2)
+    return run
+
+
+def create_path():
+    path = QPainterPath()
+    path.addRect(QRectF(0, 0, 100, 100))
+    path.addEllipse(QPointF(50, 50), 40, 20)
+    return path
+
+
+def path_translated():
+    path = create_path()
+
+    def run(count):
+        for i in range(count):
+            path.translated(1, 1)
+    return run
+
+
+def path_transformed():
+    path = create_path()
+    transform = QTransform().rotate(45)
+
+    def run(count):
+        for i in range(count):
+            transform.map(path)
+    return run
+
+
+def path_united():
+    path = create_path()
+    other = create_path().translated(50, 50)
+
+    def run(count):
+        for i in range(count):
+            path.united(other)
+    return run
+
+
+def main():
+    args = argument_parser(__doc__, 100 * 1000, "number of calls per operation").parse_args()
+
+    app = QGuiApplication(sys.argv)
+
+    large_count = max(1, args.count // 1000)
+    benchmarks = [("QImage.scaled() 64x64", image_scaled(64), args.count),
+                  ("QImage.scaled() 1024x1024", image_scaled(1024), large_count),
+                  ("QPainterPath.translated()", path_translated(), args.count),
+                  ("QTransform.map(QPainterPath)", path_transformed(), args.count),
+                  ("QPainterPath.united()", path_united(), args.count)]
+    for name, function, count in benchmarks:
+        report(name, count, measure(function, count, args.repeat))
+
+if __name__ == "__main__":
+    main()
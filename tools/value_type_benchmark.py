@@ -0,0 +1,116 @@
+#############################################################################
+##
+## Copyright (C) 2020 The Qt Company Ltd.
+## Contact: https://www.qt.io/licensing/
+##
+## This file is part of the test suite of Qt for Python.
+##
+## $QT_BEGIN_LICENSE:GPL-EXCEPT$
+## Commercial License Usage
+## Licensees holding valid commercial Qt licenses may use this file in
+## accordance with the commercial license agreement provided with the
+## Software or, alternatively, in accordance with the terms contained in
+## a written agreement between you and The Qt Company. For licensing terms
+## and conditions see https://www.qt.io/terms-conditions. For further
+## information use the contact form at https://www.qt.io/contact-us.
+##
+## GNU General Public License Usage
+## Alternatively, this file may be used under the terms of the GNU
+## General Public License version 3 as published by the Free Software
+## Foundation with exceptions as appearing in the file LICENSE.GPL3-EXCEPT
+## included in the packaging of this file. Please review the following
+## information to ensure the GNU General Public License requirements will
+## be met: https://www.gnu.org/licenses/gpl-3.0.html.
+##
+## $QT_END_LICENSE$
+##
+#############################################################################
+"""
+value_type_benchmark.py
+=======================
+
+Measures the creation and destruction of wrappers of small value types,
+which are constructed inside the Python object (inline-storage) and
+recycled through free lists (free-list-size), and the cost of a garbage
+collection while many of them are alive. The QtCore value types keep the
+default gc-tracking, so the collection traverses each of them.
+
+Usage:
+------
+
+    python value_type_benchmark.py [--count N] [--repeat N]
+
+Creates N instances (1000000 by default) of QPoint, QPointF and QRectF,
+through their constructors and through functions returning them by value,
+prints the size of a wrapper and times gc.collect() with N live QPointF.
+"""
+
+import gc
+import sys
+import time
+
+from benchmark_utils import argument_parser, measure, report
+
+from PySide2.QtCore import QPoint, QPointF, QRectF
+
+
+def construct(type, *args):
+    def run(count):
+        for i in range(count):
+            type(*args)
+    return run
+
+
+def keep_alive(type, *args):
+    def run(count):
+        values = [type(*args) for i in range(count)]
+        del values
+    return run
+
+
+def rect_center():
+    rect = QRectF(0, 0, 100, 50)
+
+    def run(count):
+        for i in range(count):
+            rect.center()
+    return run
+
+
+def point_added():
+    point = QPointF(1, 2)
+
+    def run(count):
+        for i in range(count):
+            point + point
+    return run
+
+
+def collect_garbage(count):
+    values = [QPointF(i, i) for i in range(count)]
+    start = time.perf_counter()
+    gc.collect()
+    result = time.perf_counter() - start
+    del values
+    return result
+
+
+def main():
+    args = argument_parser(__doc__, 1000 * 1000, "number of instances per operation").parse_args()
+
+    for type in (QPoint, QPointF, QRectF):
+        print("{:30} {:>8} bytes".format("sys.getsizeof({})".format(type.__name__),
+                                         sys.getsizeof(type())))
+
+    benchmarks = [("QPoint(1, 2)", construct(QPoint, 1, 2)),
+                  ("QPointF(1, 2)", construct(QPointF, 1, 2)),
+                  ("QRectF(0, 0, 100, 50)", construct(QRectF, 0, 0, 100, 50)),
+                  ("[QPointF(1, 2), ...]", keep_alive(QPointF, 1, 2)),
+                  ("QRectF.center()", rect_center()),
+                  ("QPointF + QPointF", point_added())]
+    for name, function in benchmarks:
+        report(name, args.count, measure(function, args.count, args.repeat))
+    report("gc.collect()", args.count, collect_garbage(args.count))
+
+if __name__ == "__main__":
+    main()